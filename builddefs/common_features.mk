@@ -26,6 +26,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/keymap_common.c \
     $(QUANTUM_DIR)/keycode_config.c \
     $(QUANTUM_DIR)/sync_timer.c \
+    $(QUANTUM_DIR)/task_scheduler.c \
     $(QUANTUM_DIR)/logging/debug.c \
     $(QUANTUM_DIR)/logging/sendchar.c \
     $(QUANTUM_DIR)/process_keycode/process_default_layer.c \
@@ -77,6 +78,9 @@ ifeq ($(strip $(AUDIO_ENABLE)), yes)
     SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/audio_$(strip $(AUDIO_DRIVER)).c
     SRC += $(QUANTUM_DIR)/audio/voices.c
     SRC += $(QUANTUM_DIR)/audio/luts.c
+    ifeq ($(strip $(AUDIO_DRIVER)), dac_additive)
+        SRC += $(QUANTUM_DIR)/audio/wavetable.c
+    endif
 endif
 
 ifeq ($(strip $(SEQUENCER_ENABLE)), yes)
@@ -432,6 +436,7 @@ ifeq ($(strip $(LED_MATRIX_ENABLE)), yes)
     ifeq ($(strip $(LED_MATRIX_DRIVER)), snled27351)
         I2C_DRIVER_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led
+        COMMON_VPATH += $(DRIVER_PATH)/led/issi # For issi_dirty_chunks.h
         SRC += snled27351-mono.c
     endif
 
@@ -474,6 +479,7 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/color.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_drivers.c
+    SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_spatial_index.c
     LIB8TION_ENABLE := yes
     CIE1931_CURVE := yes
 
@@ -558,6 +564,7 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), snled27351)
         I2C_DRIVER_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led
+        COMMON_VPATH += $(DRIVER_PATH)/led/issi # For issi_dirty_chunks.h
         SRC += snled27351.c
     endif
 
@@ -664,6 +671,8 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+        # Platform edge detection for MATRIX_EDGE_WAKEUP, if available
+        QUANTUM_SRC += $(wildcard $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_wakeup.c)
     endif
 endif
 
@@ -692,7 +701,8 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
         QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transport.c \
-                       $(QUANTUM_DIR)/split_common/transactions.c
+                       $(QUANTUM_DIR)/split_common/transactions.c \
+                       $(QUANTUM_DIR)/split_common/transaction_batch.c
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
@@ -709,7 +719,9 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
         ifeq ($(strip $(SERIAL_DRIVER)), bitbang)
             QUANTUM_LIB_SRC += serial.c
         else
-            QUANTUM_LIB_SRC += serial_protocol.c
+            QUANTUM_LIB_SRC += serial_protocol.c \
+                               serial_protocol_pipeline.c \
+                               serial_pipeline.c
             QUANTUM_LIB_SRC += serial_$(strip $(SERIAL_DRIVER)).c
         endif
     endif
@@ -19,6 +19,10 @@
 
 #include "eeprom_driver.h"
 
+#ifndef EEPROM_UPDATE_COMPARE_SIZE
+#    define EEPROM_UPDATE_COMPARE_SIZE 32
+#endif
+
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
     eeprom_read_block(&ret, addr, 1);
@@ -50,10 +54,19 @@ void eeprom_write_dword(uint32_t *addr, uint32_t value) {
 }
 
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
-    uint8_t read_buf[len];
-    eeprom_read_block(read_buf, addr, len);
-    if (memcmp(buf, read_buf, len) != 0) {
-        eeprom_write_block(buf, addr, len);
+    // Compared a piece at a time, so that the stack used does not grow with len
+    uint8_t        read_buf[EEPROM_UPDATE_COMPARE_SIZE];
+    const uint8_t *src  = (const uint8_t *)buf;
+    uint8_t *      dest = (uint8_t *)addr;
+    while (len > 0) {
+        size_t chunk = len < sizeof(read_buf) ? len : sizeof(read_buf);
+        eeprom_read_block(read_buf, dest, chunk);
+        if (memcmp(src, read_buf, chunk) != 0) {
+            eeprom_write_block(src, dest, chunk);
+        }
+        src += chunk;
+        dest += chunk;
+        len -= chunk;
     }
 }
 
@@ -22,3 +22,8 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+#if defined(EEPROM_WEAR_LEVELING) && defined(WEAR_LEVELING_WRITE_BACK)
+void eeprom_driver_flush(void);
+void eeprom_driver_task(void);
+#endif
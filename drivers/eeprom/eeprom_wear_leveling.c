@@ -6,6 +6,23 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#ifdef WEAR_LEVELING_WRITE_BACK
+#    include "timer.h"
+
+// Buffered writes are committed once no writes have occurred for this long...
+#    ifndef WEAR_LEVELING_WRITE_BACK_IDLE_TIME
+#        define WEAR_LEVELING_WRITE_BACK_IDLE_TIME 500
+#    endif
+
+// ...or at the latest, this long after the first buffered write.
+#    ifndef WEAR_LEVELING_WRITE_BACK_TIMEOUT
+#        define WEAR_LEVELING_WRITE_BACK_TIMEOUT 5000
+#    endif
+
+static uint32_t first_dirty_time;
+static uint32_t last_write_time;
+#endif // WEAR_LEVELING_WRITE_BACK
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -25,5 +42,30 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
+#ifdef WEAR_LEVELING_WRITE_BACK
+    bool was_dirty = wear_leveling_dirty();
+    wear_leveling_write((uint32_t)addr, buf, len);
+    last_write_time = timer_read32();
+    if (!was_dirty) {
+        first_dirty_time = last_write_time;
+    }
+#else
     wear_leveling_write((uint32_t)addr, buf, len);
+#endif // WEAR_LEVELING_WRITE_BACK
+}
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+
+void eeprom_driver_task(void) {
+    if (!wear_leveling_dirty()) {
+        return;
+    }
+
+    if (timer_elapsed32(last_write_time) >= (WEAR_LEVELING_WRITE_BACK_IDLE_TIME) || timer_elapsed32(first_dirty_time) >= (WEAR_LEVELING_WRITE_BACK_TIMEOUT)) {
+        wear_leveling_flush();
+    }
 }
+#endif // WEAR_LEVELING_WRITE_BACK
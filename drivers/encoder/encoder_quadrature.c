@@ -27,6 +27,17 @@
 #    define ENCODER_DEFAULT_PIN_API_IMPL
 #endif
 
+#if defined(ENCODER_INTERRUPT_CAPTURE) && defined(ENCODER_DEFAULT_PIN_API_IMPL) && defined(PAL_USE_CALLBACKS) && (PAL_USE_CALLBACKS == TRUE)
+// The pins are read on PAL line events instead of being polled
+#    define ENCODER_PIN_EVENTS
+#endif
+
+#ifdef ENCODER_INTERRUPT_CAPTURE
+#    define encoder_quadrature_queue_event encoder_capture_event
+#else
+#    define encoder_quadrature_queue_event encoder_queue_event
+#endif
+
 extern volatile bool isLeftHand;
 
 __attribute__((weak)) void    encoder_quadrature_init_pin(uint8_t index, bool pad_b);
@@ -89,6 +100,13 @@ __attribute__((weak)) void encoder_quadrature_post_init_kb(void) {
     // During the interrupt, read the pins then call `encoder_handle_read()` with the pin states and it'll queue up an encoder event if needed.
 }
 
+#ifdef ENCODER_PIN_EVENTS
+static void encoder_quadrature_pin_event(void *arg) {
+    uint8_t index = (uintptr_t)arg;
+    encoder_quadrature_handle_read(index, encoder_quadrature_read_pin(index, false), encoder_quadrature_read_pin(index, true));
+}
+#endif // ENCODER_PIN_EVENTS
+
 void encoder_quadrature_post_init(void) {
 #ifdef ENCODER_DEFAULT_PIN_API_IMPL
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -99,6 +117,17 @@ void encoder_quadrature_post_init(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_state[i] = (encoder_quadrature_read_pin(i, false) << 0) | (encoder_quadrature_read_pin(i, true) << 1);
     }
+#    ifdef ENCODER_PIN_EVENTS
+    for (uint8_t i = 0; i < thisCount; i++) {
+        pin_t pins[] = {encoders_pad_a[i], encoders_pad_b[i]};
+        for (uint8_t j = 0; j < ARRAY_SIZE(pins); j++) {
+            if (pins[j] != NO_PIN) {
+                palEnableLineEvent(pins[j], PAL_EVENT_MODE_BOTH_EDGES);
+                palSetLineCallback(pins[j], encoder_quadrature_pin_event, (void *)(uintptr_t)i);
+            }
+        }
+    }
+#    endif // ENCODER_PIN_EVENTS
 #else
     memset(encoder_state, 0, sizeof(encoder_state));
 #endif
@@ -180,7 +209,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     if (encoder_pulses[i] >= resolution) {
 #endif
 
-            encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE);
+            encoder_quadrature_queue_event(index, ENCODER_COUNTER_CLOCKWISE);
         }
 
 #ifdef ENCODER_DEFAULT_POS
@@ -188,7 +217,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
 #else
     if (encoder_pulses[i] <= -resolution) { // direction is arbitrary here, but this clockwise
 #endif
-            encoder_queue_event(index, ENCODER_CLOCKWISE);
+            encoder_quadrature_queue_event(index, ENCODER_CLOCKWISE);
         }
         encoder_pulses[i] %= resolution;
 #ifdef ENCODER_DEFAULT_POS
@@ -207,7 +236,9 @@ void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t
 }
 
 __attribute__((weak)) void encoder_driver_task(void) {
+#ifndef ENCODER_PIN_EVENTS
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
     }
+#endif // ENCODER_PIN_EVENTS
 }
@@ -0,0 +1,35 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Tracks which chunks of a register buffer have changed since they were last sent, one bit per chunk,
+// so that a flush only transfers those. The chunk size is the size of each I2C transfer of the buffer.
+
+/**
+ * @typedef A set of dirty chunks, bit n for the registers n * chunk_size to (n + 1) * chunk_size - 1.
+ */
+typedef uint16_t issi_dirty_chunks_t;
+
+/**
+ * The chunk holding the given register, to add to a set of dirty chunks.
+ */
+#define ISSI_DIRTY_CHUNK(reg, chunk_size) ((issi_dirty_chunks_t)1 << ((reg) / (chunk_size)))
+
+/**
+ * Takes the lowest chunk out of a non-empty set, so that they are sent in register order.
+ *
+ * @param chunks[in,out] the set of dirty chunks, which must not be empty
+ * @return the index of the chunk
+ */
+static inline uint8_t issi_dirty_chunks_take(issi_dirty_chunks_t *chunks) {
+    issi_dirty_chunks_t lowest = *chunks & -*chunks;
+    uint8_t             chunk  = 0;
+    *chunks &= ~lowest;
+    while (lowest >>= 1) {
+        chunk++;
+    }
+    return chunk;
+}
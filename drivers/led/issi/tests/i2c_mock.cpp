@@ -0,0 +1,57 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "i2c_mock.hpp"
+
+// Shared by the IS31FL37xx and SNLED27351 families
+#define REG_COMMAND 0xFD
+#define REG_COMMAND_WRITE_LOCK 0xFE
+
+MockIssi mock_issi;
+
+void MockIssi::reset() {
+    memset(pages, 0, sizeof(pages));
+    page = 0;
+    reset_counters();
+}
+
+void MockIssi::reset_counters() {
+    write_calls = 0;
+    transfers.clear();
+}
+
+void MockIssi::write(uint8_t reg, const uint8_t *data, uint16_t length) {
+    write_calls++;
+    if (reg == REG_COMMAND_WRITE_LOCK) {
+        return;
+    }
+    if (reg == REG_COMMAND) {
+        page = data[0];
+        return;
+    }
+    transfers.push_back({page, reg, length});
+    for (uint16_t i = 0; i < length && reg + i < 256; i++) {
+        pages[page][reg + i] = data[i];
+    }
+}
+
+std::vector<MockIssi::Transfer> MockIssi::transfers_to(uint8_t page) const {
+    std::vector<Transfer> result;
+    for (auto &transfer : transfers) {
+        if (transfer.page == page) {
+            result.push_back(transfer);
+        }
+    }
+    return result;
+}
+
+extern "C" {
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    mock_issi.write(regaddr, data, length);
+    return I2C_STATUS_SUCCESS;
+}
+}
@@ -0,0 +1,41 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "i2c_master.h"
+}
+
+// Emulates the paged registers of an ISSI LED driver on the I2C bus, and records the writes to it
+class MockIssi {
+   public:
+    struct Transfer {
+        uint8_t  page;
+        uint8_t  reg;
+        uint16_t length;
+    };
+
+    // Every i2c_write_register() call, including page selection
+    size_t write_calls;
+    // Writes to the selected page, in order
+    std::vector<Transfer> transfers;
+
+    uint8_t pages[8][256];
+
+    void reset();
+    void reset_counters();
+    void write(uint8_t reg, const uint8_t *data, uint16_t length);
+
+    // Transfers to the given page
+    std::vector<Transfer> transfers_to(uint8_t page) const;
+
+   private:
+    uint8_t page;
+};
+
+extern MockIssi mock_issi;
@@ -0,0 +1,98 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "i2c_mock.hpp"
+
+extern "C" {
+#include "is31fl3733.h"
+
+// Every PWM register is used, red in the first 64, then green, then blue
+#define LED(i) \
+    { 0, (i), 64 + (i), 128 + (i) }
+#define LED8(i) LED(i), LED(i + 1), LED(i + 2), LED(i + 3), LED(i + 4), LED(i + 5), LED(i + 6), LED(i + 7)
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    LED8(0), LED8(8), LED8(16), LED8(24), LED8(32), LED8(40), LED8(48), LED8(56),
+};
+}
+
+class IS31FL3733 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_issi.reset();
+        is31fl3733_init_drivers();
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+        mock_issi.reset_counters();
+    }
+
+    void expect_device_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+        EXPECT_EQ(mock_issi.pages[IS31FL3733_COMMAND_PWM][index], red);
+        EXPECT_EQ(mock_issi.pages[IS31FL3733_COMMAND_PWM][64 + index], green);
+        EXPECT_EQ(mock_issi.pages[IS31FL3733_COMMAND_PWM][128 + index], blue);
+    }
+};
+
+TEST_F(IS31FL3733, Flush_NothingChanged_NoWrites) {
+    is31fl3733_flush();
+    EXPECT_EQ(mock_issi.write_calls, 0);
+}
+
+TEST_F(IS31FL3733, SetColor_OneLed_SendsItsChunks) {
+    is31fl3733_set_color(20, 1, 2, 3);
+    is31fl3733_flush();
+
+    // Page selection, then one 16 byte chunk for each of red, green and blue
+    EXPECT_EQ(mock_issi.write_calls, 2 + 3);
+    auto transfers = mock_issi.transfers_to(IS31FL3733_COMMAND_PWM);
+    ASSERT_EQ(transfers.size(), 3);
+    EXPECT_EQ(transfers[0].reg, 16);
+    EXPECT_EQ(transfers[1].reg, 80);
+    EXPECT_EQ(transfers[2].reg, 144);
+    for (auto &transfer : transfers) {
+        EXPECT_EQ(transfer.length, 16);
+    }
+    expect_device_color(20, 1, 2, 3);
+
+    mock_issi.reset_counters();
+    is31fl3733_flush();
+    EXPECT_EQ(mock_issi.write_calls, 0);
+}
+
+TEST_F(IS31FL3733, SetColor_SameChunks_SentOnce) {
+    is31fl3733_set_color(16, 1, 2, 3);
+    is31fl3733_set_color(17, 4, 5, 6);
+    is31fl3733_set_color(31, 7, 8, 9);
+    is31fl3733_flush();
+
+    auto transfers = mock_issi.transfers_to(IS31FL3733_COMMAND_PWM);
+    ASSERT_EQ(transfers.size(), 3);
+    EXPECT_EQ(transfers[0].reg, 16);
+    EXPECT_EQ(transfers[1].reg, 64 + 16);
+    EXPECT_EQ(transfers[2].reg, 128 + 16);
+    expect_device_color(16, 1, 2, 3);
+    expect_device_color(17, 4, 5, 6);
+    expect_device_color(31, 7, 8, 9);
+}
+
+TEST_F(IS31FL3733, SetColor_Unchanged_NoWrites) {
+    is31fl3733_set_color(5, 0, 0, 0);
+    is31fl3733_flush();
+    EXPECT_EQ(mock_issi.write_calls, 0);
+}
+
+TEST_F(IS31FL3733, SetColorAll_SendsEveryChunkInOrder) {
+    is31fl3733_set_color_all(10, 20, 30);
+    is31fl3733_flush();
+
+    // As many writes as when the whole buffer was sent every time
+    EXPECT_EQ(mock_issi.write_calls, 2 + 12);
+    auto transfers = mock_issi.transfers_to(IS31FL3733_COMMAND_PWM);
+    ASSERT_EQ(transfers.size(), 12);
+    for (size_t i = 0; i < transfers.size(); i++) {
+        EXPECT_EQ(transfers[i].reg, i * 16);
+    }
+    for (int i = 0; i < IS31FL3733_LED_COUNT; i++) {
+        expect_device_color(i, 10, 20, 30);
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "i2c_mock.hpp"
+
+extern "C" {
+#include "is31fl3741.h"
+
+// Red and green on the first PWM page, blue on the second
+#define LED(i) \
+    { 0, (i), 64 + (i), 0x100 + (i) }
+#define LED8(i) LED(i), LED(i + 1), LED(i + 2), LED(i + 3), LED(i + 4), LED(i + 5), LED(i + 6), LED(i + 7)
+const is31fl3741_led_t PROGMEM g_is31fl3741_leds[IS31FL3741_LED_COUNT] = {
+    LED8(0), LED8(8), LED8(16), LED8(24), LED8(32), LED8(40), LED8(48), LED8(56),
+};
+}
+
+class IS31FL3741 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_issi.reset();
+        is31fl3741_init_drivers();
+        is31fl3741_set_color_all(0, 0, 0);
+        is31fl3741_flush();
+        mock_issi.reset_counters();
+    }
+};
+
+TEST_F(IS31FL3741, Flush_NothingChanged_NoWrites) {
+    is31fl3741_flush();
+    EXPECT_EQ(mock_issi.write_calls, 0);
+}
+
+TEST_F(IS31FL3741, SetColor_OnePage_OnlySelectsThatPage) {
+    is31fl3741_set_color(40, 0, 0, 5);
+    is31fl3741_flush();
+
+    // Page selection, then the 19 byte chunk holding blue
+    EXPECT_EQ(mock_issi.write_calls, 2 + 1);
+    auto transfers = mock_issi.transfers_to(IS31FL3741_COMMAND_PWM_1);
+    ASSERT_EQ(transfers.size(), 1);
+    EXPECT_EQ(transfers[0].reg, 38);
+    EXPECT_EQ(transfers[0].length, 19);
+    EXPECT_EQ(mock_issi.pages[IS31FL3741_COMMAND_PWM_1][40], 5);
+}
+
+TEST_F(IS31FL3741, SetColor_BothPages) {
+    is31fl3741_set_color(0, 1, 2, 3);
+    is31fl3741_flush();
+
+    EXPECT_EQ(mock_issi.write_calls, 2 + 2 + 2 + 1);
+    auto page_0 = mock_issi.transfers_to(IS31FL3741_COMMAND_PWM_0);
+    ASSERT_EQ(page_0.size(), 2);
+    EXPECT_EQ(page_0[0].reg, 0);
+    EXPECT_EQ(page_0[1].reg, 60);
+    EXPECT_EQ(page_0[0].length, 30);
+    auto page_1 = mock_issi.transfers_to(IS31FL3741_COMMAND_PWM_1);
+    ASSERT_EQ(page_1.size(), 1);
+    EXPECT_EQ(page_1[0].reg, 0);
+
+    EXPECT_EQ(mock_issi.pages[IS31FL3741_COMMAND_PWM_0][0], 1);
+    EXPECT_EQ(mock_issi.pages[IS31FL3741_COMMAND_PWM_0][64], 2);
+    EXPECT_EQ(mock_issi.pages[IS31FL3741_COMMAND_PWM_1][0], 3);
+}
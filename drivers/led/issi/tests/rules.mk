@@ -0,0 +1,25 @@
+issi_common_SRC := \
+	$(DRIVER_PATH)/led/issi/tests/i2c_mock.cpp \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+issi_common_INC := \
+	$(DRIVER_PATH) \
+	$(DRIVER_PATH)/led/issi
+
+is31fl3733_DEFS := \
+	-DIS31FL3733_I2C_ADDRESS_1=IS31FL3733_I2C_ADDRESS_GND_GND \
+	-DIS31FL3733_LED_COUNT=64
+is31fl3733_SRC := \
+	$(issi_common_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3733.c \
+	$(DRIVER_PATH)/led/issi/tests/is31fl3733_tests.cpp
+is31fl3733_INC := $(issi_common_INC)
+
+is31fl3741_DEFS := \
+	-DIS31FL3741_I2C_ADDRESS_1=IS31FL3741_I2C_ADDRESS_GND \
+	-DIS31FL3741_LED_COUNT=64
+is31fl3741_SRC := \
+	$(issi_common_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3741.c \
+	$(DRIVER_PATH)/led/issi/tests/is31fl3741_tests.cpp
+is31fl3741_INC := $(issi_common_INC)
@@ -0,0 +1 @@
+TEST_LIST += is31fl3733 is31fl3741
@@ -0,0 +1,8 @@
+ws2812_DEFS := \
+	-DRGBLIGHT_WS2812 \
+	-DRGBLIGHT_LED_COUNT=8
+ws2812_SRC := \
+	$(DRIVER_PATH)/led/ws2812.c \
+	$(DRIVER_PATH)/led/tests/ws2812_tests.cpp
+ws2812_INC := \
+	$(DRIVER_PATH)/led
@@ -0,0 +1,91 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812.h"
+}
+
+// A serial driver as the bitbang and PIO drivers are, which sends the LEDs up to the last changed one
+static ws2812_led_t              leds[WS2812_LED_COUNT];
+static std::vector<ws2812_led_t> sent;
+static int                       transfers;
+
+extern "C" {
+
+void ws2812_init(void) {}
+
+void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    ws2812_update_led(leds, index, red, green, blue);
+}
+
+void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        ws2812_set_color(i, red, green, blue);
+    }
+}
+
+void ws2812_flush(void) {
+    ws2812_dirty_range_t range = ws2812_take_dirty_range();
+    if (range.end == 0) {
+        return;
+    }
+    transfers++;
+    sent.assign(leds, leds + range.end);
+}
+}
+
+class WS2812 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        ws2812_set_color_all(0, 0, 0);
+        ws2812_flush();
+        sent.clear();
+        transfers = 0;
+    }
+};
+
+TEST_F(WS2812, IdenticalFrame_Skipped) {
+    ws2812_set_color_all(1, 2, 3);
+    ws2812_flush();
+    EXPECT_EQ(transfers, 1);
+    EXPECT_EQ(sent.size(), WS2812_LED_COUNT);
+
+    ws2812_set_color_all(1, 2, 3);
+    ws2812_flush();
+    EXPECT_EQ(transfers, 1);
+}
+
+TEST_F(WS2812, OneLedChanged_SentUpToIt) {
+    ws2812_set_color(2, 1, 2, 3);
+    ws2812_flush();
+    EXPECT_EQ(transfers, 1);
+    ASSERT_EQ(sent.size(), 3);
+    EXPECT_EQ(sent[2].r, 1);
+    EXPECT_EQ(sent[2].g, 2);
+    EXPECT_EQ(sent[2].b, 3);
+}
+
+TEST_F(WS2812, Invalidated_IdenticalFrameSentAgain) {
+    ws2812_set_color_all(1, 2, 3);
+    ws2812_flush();
+    sent.clear();
+
+    // As after a wakeup, when the LEDs may have lost power
+    ws2812_invalidate();
+    ws2812_set_color_all(1, 2, 3);
+    ws2812_flush();
+    EXPECT_EQ(transfers, 2);
+    ASSERT_EQ(sent.size(), WS2812_LED_COUNT);
+    for (auto &led : sent) {
+        EXPECT_EQ(led.r, 1);
+        EXPECT_EQ(led.g, 2);
+        EXPECT_EQ(led.b, 3);
+    }
+
+    ws2812_flush();
+    EXPECT_EQ(transfers, 2);
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "ws2812.h"
+#include <string.h>
 
 #if defined(WS2812_RGBW)
 void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
@@ -13,3 +14,41 @@ void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
     led->b -= led->w;
 }
 #endif
+
+// everything is sent on the first flush
+static ws2812_dirty_range_t dirty = {.first = 0, .end = WS2812_LED_COUNT};
+
+bool ws2812_update_led(ws2812_led_t *leds, int index, uint8_t red, uint8_t green, uint8_t blue) {
+    ws2812_led_t led = {0};
+    led.r            = red;
+    led.g            = green;
+    led.b            = blue;
+#if defined(WS2812_RGBW)
+    ws2812_rgb_to_rgbw(&led);
+#endif
+
+    if (memcmp(&leds[index], &led, sizeof(ws2812_led_t)) == 0) {
+        return false;
+    }
+    leds[index] = led;
+
+    if (dirty.end == 0) {
+        dirty.first = index;
+        dirty.end   = index + 1;
+    } else {
+        dirty.first = MIN(dirty.first, index);
+        dirty.end   = MAX(dirty.end, index + 1);
+    }
+    return true;
+}
+
+void ws2812_invalidate(void) {
+    dirty.first = 0;
+    dirty.end   = WS2812_LED_COUNT;
+}
+
+ws2812_dirty_range_t ws2812_take_dirty_range(void) {
+    ws2812_dirty_range_t range = dirty;
+    dirty.first = dirty.end = 0;
+    return range;
+}
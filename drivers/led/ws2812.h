@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stdint.h>
 #include "util.h"
 
 /*
@@ -95,3 +97,32 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
+
+/**
+ * \brief Range of LEDs changed since the last flush, `end` is exclusive.
+ */
+typedef struct {
+    uint16_t first;
+    uint16_t end;
+} ws2812_dirty_range_t;
+
+/**
+ * \brief Stores a color in the LED buffer, and marks the LED dirty if the
+ * color differs from the one already stored.
+ *
+ * \return true if the LED changed
+ */
+bool ws2812_update_led(ws2812_led_t *leds, int index, uint8_t red, uint8_t green, uint8_t blue);
+
+/**
+ * \brief Marks all LEDs dirty, e.g. after the LEDs lost power.
+ */
+void ws2812_invalidate(void);
+
+/**
+ * \brief Returns the LEDs to send on flush and marks them clean again.
+ *
+ * Drivers skip the transfer if `end` is 0. As the LEDs in a chain keep their
+ * color when less data arrives, serial drivers may stop after `end` LEDs.
+ */
+ws2812_dirty_range_t ws2812_take_dirty_range(void);
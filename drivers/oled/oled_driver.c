@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <string.h>
 #include "progmem.h"
 #include "wait.h"
+#include "util.h"
 
 // Used commands from spec sheet: https://cdn-shop.adafruit.com/datasheets/SSD1306.pdf
 // for SH1106: https://www.velleman.eu/downloads/29/infosheets/sh1106_datasheet.pdf
@@ -114,6 +115,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_PRE_CHARGE_PERIOD 0xF1
 #endif
 
+// Dirty blocks on the same page are sent in one transfer if they are at most this many bytes apart
+#if !defined(OLED_DIRTY_MERGE_GAP)
+#    define OLED_DIRTY_MERGE_GAP 8
+#endif
+
 #define OLED_ALL_BLOCKS_MASK (((((OLED_BLOCK_TYPE)1 << (OLED_BLOCK_COUNT - 1)) - 1) << 1) | 1)
 
 #define OLED_IC_HAS_HORIZONTAL_MODE (OLED_IC == OLED_IC_SSD1306)
@@ -161,6 +167,16 @@ uint8_t         oled_scroll_end     = 7;
 #if OLED_TIMEOUT > 0
 uint32_t oled_timeout;
 #endif
+
+// The changed bytes of each dirty block, a length of 0 is the whole block
+typedef struct {
+    uint8_t start;
+    uint8_t length;
+} oled_dirty_range_t;
+
+static oled_dirty_range_t oled_dirty_ranges[OLED_BLOCK_COUNT];
+
+STATIC_ASSERT(OLED_BLOCK_SIZE <= 256, "OLED_BLOCK_SIZE must fit the dirty ranges");
 #if OLED_SCROLL_TIMEOUT > 0
 uint32_t oled_scroll_timeout;
 #endif
@@ -285,6 +301,42 @@ static void InvertCharacter(uint8_t *cursor) {
     }
 }
 
+// Marks the buffer bytes from index onwards as changed
+static void oled_mark_dirty(uint16_t index, uint16_t length) {
+    uint16_t end = index + length;
+    if (end > OLED_MATRIX_SIZE) {
+        end = OLED_MATRIX_SIZE;
+    }
+
+    while (index < end) {
+        uint8_t             block       = index / OLED_BLOCK_SIZE;
+        uint16_t            block_start = block * OLED_BLOCK_SIZE;
+        uint16_t            start       = index - block_start;
+        uint16_t            stop        = MIN(end - block_start, OLED_BLOCK_SIZE);
+        oled_dirty_range_t *range       = &oled_dirty_ranges[block];
+
+        if (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << block))) {
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << block);
+            range->start = start;
+        } else if (range->length == 0) {
+            // Already dirty as a whole
+            index = block_start + OLED_BLOCK_SIZE;
+            continue;
+        } else {
+            stop         = MAX(stop, range->start + range->length);
+            range->start = MIN(start, range->start);
+        }
+        range->length = stop - range->start < OLED_BLOCK_SIZE ? stop - range->start : 0;
+
+        index = block_start + OLED_BLOCK_SIZE;
+    }
+}
+
+static void oled_mark_all_dirty(void) {
+    oled_dirty = OLED_ALL_BLOCKS_MASK;
+    memset(oled_dirty_ranges, 0, sizeof(oled_dirty_ranges));
+}
+
 bool oled_init(oled_rotation_t rotation) {
 #if defined(USE_I2C) && defined(SPLIT_KEYBOARD) && defined(OLED_TRANSPORT_I2C)
     if (!is_keyboard_master()) {
@@ -381,13 +433,13 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 void oled_clear(void) {
     memset(oled_buffer, 0, sizeof(oled_buffer));
     oled_cursor = &oled_buffer[0];
-    oled_dirty  = OLED_ALL_BLOCKS_MASK;
+    oled_mark_all_dirty();
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
+static void calc_bounds(uint16_t start, uint16_t length, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
-    uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
+    uint8_t start_page   = start / OLED_DISPLAY_WIDTH;
+    uint8_t start_column = start % OLED_DISPLAY_WIDTH;
 #if !OLED_IC_HAS_HORIZONTAL_MODE
     // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
     // Column value must be split into high and low nybble and sent as two commands.
@@ -398,8 +450,8 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     // Commands for use in Horizontal Addressing mode.
     cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
     cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+    cmd_array[2] = (length + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
+    cmd_array[5] = (length + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
 #endif
 }
 
@@ -465,6 +517,36 @@ void oled_render_dirty(bool all) {
         while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
             ++update_start;
         }
+        uint8_t update_end = update_start;
+
+        // Bytes of the buffer to send, only used without rotation
+        uint16_t start  = OLED_BLOCK_SIZE * update_start;
+        uint16_t length = OLED_BLOCK_SIZE;
+        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+            oled_dirty_range_t range = oled_dirty_ranges[update_start];
+            if (range.length != 0) {
+                start += range.start;
+                length = range.length;
+            }
+
+            // A partial range is sent as one window, which must not wrap to the next page
+            if (start / OLED_DISPLAY_WIDTH == (start + length - 1) / OLED_DISPLAY_WIDTH) {
+                // Extend the window over the following dirty blocks on the same page
+                while (update_end + 1 < OLED_BLOCK_COUNT && (oled_dirty & ((OLED_BLOCK_TYPE)1 << (update_end + 1)))) {
+                    oled_dirty_range_t next       = oled_dirty_ranges[update_end + 1];
+                    uint16_t           next_start = OLED_BLOCK_SIZE * (update_end + 1) + next.start;
+                    uint16_t           next_end   = next_start + (next.length != 0 ? next.length : OLED_BLOCK_SIZE);
+                    if (next_start - (start + length) > OLED_DIRTY_MERGE_GAP || start / OLED_DISPLAY_WIDTH != (next_end - 1) / OLED_DISPLAY_WIDTH) {
+                        break;
+                    }
+                    length = next_end - start;
+                    ++update_end;
+                }
+            } else {
+                start  = OLED_BLOCK_SIZE * update_start;
+                length = OLED_BLOCK_SIZE;
+            }
+        }
 
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
@@ -473,7 +555,7 @@ void oled_render_dirty(bool all) {
         static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
 #endif
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+            calc_bounds(start, length, &display_start[1]); // Offset from I2C_CMD byte at the start
         } else {
             calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         }
@@ -486,7 +568,7 @@ void oled_render_dirty(bool all) {
 
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
             // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
+            if (!oled_send_data(&oled_buffer[start], length)) {
                 print("oled_render data failed\n");
                 return;
             }
@@ -529,8 +611,12 @@ void oled_render_dirty(bool all) {
 #endif
         }
 
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        // Clear dirty flags of just rendered blocks
+        for (; update_start <= update_end; ++update_start) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            oled_dirty_ranges[update_start].length = 0;
+        }
+        --update_start;
     }
 }
 
@@ -622,9 +708,16 @@ void oled_write_char(const char data, bool invert) {
     // Dirty check
     if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
         uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-        // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+        // Only the columns which changed, this may span 2 chunks
+        uint8_t first = 0;
+        uint8_t last  = OLED_FONT_WIDTH - 1;
+        while (oled_temp_buffer[first] == oled_cursor[first]) {
+            ++first;
+        }
+        while (oled_temp_buffer[last] == oled_cursor[last]) {
+            --last;
+        }
+        oled_mark_dirty(index + first, last - first + 1);
     }
 
     // Finally move to the next char
@@ -659,7 +752,7 @@ void oled_pan(bool left) {
             }
         }
     }
-    oled_dirty = OLED_ALL_BLOCKS_MASK;
+    oled_mark_all_dirty();
 }
 
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
@@ -674,7 +767,7 @@ void oled_write_raw_byte(const char data, uint16_t index) {
     if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
     if (oled_buffer[index] == data) return;
     oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    oled_mark_dirty(index, 1);
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
@@ -684,7 +777,7 @@ void oled_write_raw(const char *data, uint16_t size) {
         uint8_t c = *data++;
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_mark_dirty(i, 1);
     }
 }
 
@@ -704,7 +797,7 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     }
     if (oled_buffer[index] != data) {
         oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        oled_mark_dirty(index, 1);
     }
 }
 
@@ -729,7 +822,7 @@ void oled_write_raw_P(const char *data, uint16_t size) {
         uint8_t c = pgm_read_byte(data++);
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_mark_dirty(i, 1);
     }
 }
 #endif // defined(__AVR__)
@@ -879,7 +972,7 @@ bool oled_scroll_off(void) {
             return oled_scrolling;
         }
         oled_scrolling = false;
-        oled_dirty     = OLED_ALL_BLOCKS_MASK;
+        oled_mark_all_dirty();
     }
     return !oled_scrolling;
 }
@@ -0,0 +1,77 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "i2c_mock.hpp"
+
+MockDisplay mock_display;
+
+void MockDisplay::reset() {
+    memset(ram, 0, sizeof(ram));
+    column_start = column = page_start = page = 0;
+    column_end                                = OLED_DISPLAY_WIDTH - 1;
+    page_end                                  = OLED_DISPLAY_HEIGHT / 8 - 1;
+    reset_counters();
+}
+
+void MockDisplay::reset_counters() {
+    bus_bytes  = 0;
+    data_bytes = 0;
+    transfers  = 0;
+}
+
+void MockDisplay::command(const uint8_t *data, uint16_t length) {
+    // Skip the control byte, only the addressing commands are emulated
+    for (uint16_t i = 1; i < length; i++) {
+        switch (data[i]) {
+            case 0x21: // COLUMN_ADDR
+                column_start = column = data[++i];
+                column_end            = data[++i];
+                break;
+            case 0x22: // PAGE_ADDR
+                page_start = page = data[++i];
+                page_end          = data[++i];
+                break;
+            case 0x20: // MEMORY_MODE
+            case 0x81: // CONTRAST
+            case 0x8D: // CHARGE_PUMP
+            case 0xA8: // MULTIPLEX_RATIO
+            case 0xD3: // DISPLAY_OFFSET
+            case 0xD5: // DISPLAY_CLOCK
+            case 0xD9: // PRE_CHARGE_PERIOD
+            case 0xDA: // COM_PINS
+            case 0xDB: // VCOM_DETECT
+                i++;
+                break;
+        }
+    }
+}
+
+void MockDisplay::write(const uint8_t *data, uint16_t length) {
+    transfers++;
+    data_bytes += length;
+    for (uint16_t i = 0; i < length; i++) {
+        ram[page * OLED_DISPLAY_WIDTH + column] = data[i];
+        if (column++ == column_end) {
+            column = column_start;
+            page   = page == page_end ? page_start : page + 1;
+        }
+    }
+}
+
+extern "C" {
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    mock_display.bus_bytes += 1 + length;
+    mock_display.command(data, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    mock_display.bus_bytes += 2 + length;
+    mock_display.write(data, length);
+    return I2C_STATUS_SUCCESS;
+}
+}
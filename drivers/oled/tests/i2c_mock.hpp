@@ -0,0 +1,36 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+extern "C" {
+#include "i2c_master.h"
+#include "oled_driver.h"
+}
+
+// Emulates an SSD1306 in horizontal addressing mode on the I2C bus, and counts the bytes sent to it
+class MockDisplay {
+   public:
+    // Bytes on the bus, including the address and control bytes of each transaction
+    size_t bus_bytes;
+    // Display data bytes written to the display memory
+    size_t data_bytes;
+    // Data transactions, i.e. windows written to
+    size_t transfers;
+
+    uint8_t ram[OLED_MATRIX_SIZE];
+
+    void reset();
+    void reset_counters();
+    void command(const uint8_t *data, uint16_t length);
+    void write(const uint8_t *data, uint16_t length);
+
+   private:
+    uint8_t column_start, column_end, column;
+    uint8_t page_start, page_end, page;
+};
+
+extern MockDisplay mock_display;
@@ -0,0 +1,202 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include <string>
+#include "gtest/gtest.h"
+#include "i2c_mock.hpp"
+
+extern "C" {
+extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+}
+
+class OledDriver : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_display.reset();
+        ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+        oled_render_dirty(true);
+        mock_display.reset_counters();
+    }
+
+    void render() {
+        oled_render_dirty(true);
+        EXPECT_EQ(oled_dirty, 0);
+    }
+
+    void expect_display_matches() {
+        for (size_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+            ASSERT_EQ(mock_display.ram[i], oled_buffer[i]) << "Display differs from the buffer at " << i;
+        }
+    }
+
+    // The bytes the dirty blocks cost when each is sent whole with its own window
+    size_t whole_block_bytes() {
+        size_t blocks = 0;
+        for (size_t i = 0; i < OLED_BLOCK_COUNT; i++) {
+            blocks += (oled_dirty >> i) & 1;
+        }
+        // Address, control and 6 addressing bytes, then address, control and data
+        return blocks * (8 + 2 + OLED_BLOCK_SIZE);
+    }
+};
+
+TEST_F(OledDriver, Clear_RedrawsEverything) {
+    oled_write_ln("QMK", false);
+    oled_clear();
+    render();
+    EXPECT_EQ(mock_display.data_bytes, OLED_MATRIX_SIZE);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, UnchangedCharacter_SendsNothing) {
+    oled_write_char('A', false);
+    render();
+    mock_display.reset_counters();
+
+    oled_set_cursor(0, 0);
+    oled_write_char('A', false);
+    render();
+    EXPECT_EQ(mock_display.bus_bytes, 0);
+}
+
+TEST_F(OledDriver, Character_SendsOnlyItsColumns) {
+    oled_set_cursor(3, 1);
+    oled_write_char('A', false);
+    render();
+    EXPECT_EQ(mock_display.transfers, 1);
+    EXPECT_LE(mock_display.data_bytes, OLED_FONT_WIDTH);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, ChangedCharacter_SendsOnlyChangedColumns) {
+    oled_set_cursor(2, 0);
+    oled_write_char('E', false);
+    render();
+    mock_display.reset_counters();
+
+    // Only the rightmost columns of the glyphs differ
+    oled_set_cursor(2, 0);
+    oled_write_char('F', false);
+    render();
+    EXPECT_EQ(mock_display.transfers, 1);
+    EXPECT_GT(mock_display.data_bytes, 0);
+    EXPECT_LT(mock_display.data_bytes, OLED_FONT_WIDTH);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, LineAcrossBlocks_SentInOneTransfer) {
+    oled_write("0123456789ABCDEFGHI", false);
+    EXPECT_GT(__builtin_popcount(oled_dirty), 1) << "The line should span several blocks";
+    render();
+    EXPECT_EQ(mock_display.transfers, 1);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, FarApartOnOnePage_SentSeparately) {
+    oled_set_cursor(0, 0);
+    oled_write_char('L', false);
+    oled_set_cursor(20, 0);
+    oled_write_char('R', false);
+    render();
+    EXPECT_EQ(mock_display.transfers, 2);
+    EXPECT_LE(mock_display.data_bytes, 2 * OLED_FONT_WIDTH);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, SeparatePages_SentSeparately) {
+    oled_set_cursor(20, 0);
+    oled_write_char('X', false);
+    oled_set_cursor(0, 1);
+    oled_write_char('Y', false);
+    render();
+    EXPECT_EQ(mock_display.transfers, 2);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, Pixel_SendsOneByte) {
+    oled_write_pixel(77, 13, true);
+    render();
+    EXPECT_EQ(mock_display.data_bytes, 1);
+    expect_display_matches();
+
+    mock_display.reset_counters();
+    oled_write_raw_byte(0x5A, OLED_MATRIX_SIZE - 1);
+    render();
+    EXPECT_EQ(mock_display.data_bytes, 1);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, RawWrite_MarksWhatChanged) {
+    char data[OLED_DISPLAY_WIDTH + 10];
+    memset(data, 0x81, sizeof(data));
+    oled_set_cursor(0, 1);
+    oled_write_raw(data, sizeof(data));
+    render();
+    EXPECT_EQ(mock_display.data_bytes, sizeof(data));
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, Pan_RedrawsEverything) {
+    oled_write("Panning", false);
+    render();
+    mock_display.reset_counters();
+
+    oled_pan(true);
+    render();
+    EXPECT_EQ(mock_display.data_bytes, OLED_MATRIX_SIZE);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, DirtySetDirectly_SendsWholeBlock) {
+    oled_buffer[OLED_BLOCK_SIZE + 1] = 0xFF;
+    oled_dirty |= (OLED_BLOCK_TYPE)1 << 1;
+    oled_write_pixel(OLED_BLOCK_SIZE % OLED_DISPLAY_WIDTH + 5, OLED_BLOCK_SIZE / OLED_DISPLAY_WIDTH * 8, true);
+    render();
+    EXPECT_EQ(mock_display.data_bytes, OLED_BLOCK_SIZE);
+    expect_display_matches();
+}
+
+TEST_F(OledDriver, StatusFrame_BytesPerFrame) {
+    oled_write_ln("Layer: Base", false);
+    oled_write_ln("WPM: 042", false);
+    oled_write_ln("Caps: off", false);
+    render();
+
+    const char *frames[][3] = {
+        {"Layer: Base", "WPM: 043", "Caps: off"},
+        {"Layer: Base", "WPM: 051", "Caps: off"},
+        {"Layer: Nav", "WPM: 051", "Caps: off"},
+        {"Layer: Nav", "WPM: 060", "Caps: on"},
+    };
+    size_t bus_bytes = 0;
+    size_t old_bytes = 0;
+    for (auto &frame : frames) {
+        oled_set_cursor(0, 0);
+        for (auto line : frame) {
+            oled_write_ln(line, false);
+        }
+        old_bytes += whole_block_bytes();
+        mock_display.reset_counters();
+        render();
+        bus_bytes += mock_display.bus_bytes;
+        expect_display_matches();
+    }
+
+    std::cout << OLED_DISPLAY_WIDTH << "x" << OLED_DISPLAY_HEIGHT << ": " << bus_bytes << " bytes for " << sizeof(frames) / sizeof(frames[0]) << " frames, " << old_bytes << " with whole blocks" << std::endl;
+    RecordProperty("bus_bytes", std::to_string(bus_bytes));
+    RecordProperty("whole_block_bus_bytes", std::to_string(old_bytes));
+    EXPECT_LT(bus_bytes, old_bytes / 2);
+}
+
+TEST_F(OledDriver, Rotation90_SendsWholeBlocks) {
+    ASSERT_TRUE(oled_init(OLED_ROTATION_90));
+    render();
+    mock_display.reset_counters();
+
+    oled_write_char('A', false);
+    render();
+    EXPECT_EQ(mock_display.data_bytes % OLED_BLOCK_SIZE, 0);
+    EXPECT_GT(mock_display.data_bytes, 0);
+}
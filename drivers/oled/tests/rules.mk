@@ -0,0 +1,20 @@
+oled_common_DEFS := \
+	-DOLED_TRANSPORT_I2C \
+	-DOLED_DISABLE_TIMEOUT
+oled_common_SRC := \
+	$(DRIVER_PATH)/oled/oled_driver.c \
+	$(DRIVER_PATH)/oled/tests/i2c_mock.cpp \
+	$(DRIVER_PATH)/oled/tests/oled_tests.cpp \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+oled_common_INC := \
+	$(DRIVER_PATH) \
+	$(DRIVER_PATH)/oled
+
+oled_128x32_DEFS := $(oled_common_DEFS)
+oled_128x32_SRC  := $(oled_common_SRC)
+oled_128x32_INC  := $(oled_common_INC)
+
+oled_128x64_DEFS := $(oled_common_DEFS) -DOLED_DISPLAY_128X64
+oled_128x64_SRC  := $(oled_common_SRC)
+oled_128x64_INC  := $(oled_common_INC)
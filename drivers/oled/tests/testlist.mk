@@ -0,0 +1 @@
+TEST_LIST += oled_128x32 oled_128x64
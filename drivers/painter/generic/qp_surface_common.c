@@ -110,6 +110,11 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
     painter_driver_t *        target_driver  = (painter_driver_t *)target;
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Draw any queued drawing commands into the surface before copying it out
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     // If we're not dirty... we're done.
     if (!surface_handle->dirty.is_dirty) {
         qp_dprintf("qp_surface_draw: ok (not dirty, skipping)\n");
@@ -131,7 +136,7 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     }
 
     // Clear the dirty info for the surface
-    ok = qp_flush(surface);
+    ok = qp_internal_flush(surface);
     if (!ok) {
         qp_dprintf("qp_surface_draw: fail (could not flush)\n");
         return false;
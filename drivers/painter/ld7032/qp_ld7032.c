@@ -277,7 +277,7 @@ bool qp_ld7032_flush(painter_device_t device) {
     }
 
     // Clear the dirty area
-    qp_flush(&driver->oled.surface);
+    qp_internal_flush(&driver->oled.surface);
 
     return true;
 }
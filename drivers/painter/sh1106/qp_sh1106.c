@@ -100,7 +100,7 @@ bool qp_sh1106_flush(painter_device_t device) {
     }
 
     // Clear the dirty area
-    qp_flush(&driver->oled.surface);
+    qp_internal_flush(&driver->oled.surface);
 
     return true;
 }
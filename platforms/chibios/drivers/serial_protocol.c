@@ -7,6 +7,9 @@
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 
+// The pipelined protocol in serial_protocol_pipeline.c takes over from this one
+#if !defined(SERIAL_USART_PIPELINE)
+
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
@@ -156,3 +159,5 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#endif // !defined(SERIAL_USART_PIPELINE)
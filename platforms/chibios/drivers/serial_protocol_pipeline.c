@@ -0,0 +1,148 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#if defined(SERIAL_USART_PIPELINE)
+
+#    include <ch.h>
+#    include <string.h>
+
+#    include "serial.h"
+#    include "serial_protocol.h"
+#    include "serial_pipeline.h"
+#    include "synchronization_util.h"
+
+#    if !defined(SERIAL_DRIVER_USART) || !defined(SERIAL_USART_FULL_DUPLEX)
+#        error SERIAL_USART_PIPELINE needs the usart driver in full-duplex mode.
+#    endif
+
+#    if !HAL_USE_SERIAL
+#        error SERIAL_USART_PIPELINE needs the SERIAL driver, as the hardware FIFO of the SIO driver is too small to hold the replies while the master carries on.
+#    endif
+
+static serial_pipeline_t pipeline;
+
+static bool pipeline_send(const uint8_t* data, size_t size) {
+    return serial_transport_send(data, size);
+}
+
+static size_t pipeline_receive(uint8_t* data, size_t size) {
+    return serial_transport_receive_available(data, size);
+}
+
+static void pipeline_idle(void) {
+    chThdYield();
+}
+
+static uint32_t pipeline_now_us(void) {
+    /* Each half only runs one side of the pipeline, so this is only ever called from one thread. */
+    static systime_t last_ticks;
+    static uint64_t  elapsed_ticks;
+
+    systime_t ticks = chVTGetSystemTimeX();
+    elapsed_ticks += chTimeDiffX(last_ticks, ticks);
+    last_ticks = ticks;
+    return (uint32_t)(elapsed_ticks * 1000000 / CH_CFG_ST_FREQUENCY);
+}
+
+static const serial_pipeline_io_t pipeline_io = {
+    .send    = pipeline_send,
+    .receive = pipeline_receive,
+    .idle    = pipeline_idle,
+    .now_us  = pipeline_now_us,
+};
+
+/**
+ * @brief Runs a transaction on the slave, straight from the received frame.
+ */
+static bool react_to_transaction(uint8_t transaction_id, const uint8_t* request, uint8_t request_length, uint8_t* response, uint8_t* response_length, bool repeated) {
+    /* Sanity check that we are actually responding to a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+    if (unlikely(request_length != transaction->initiator2target_buffer_size)) {
+        return false;
+    }
+
+    /* Only the response was lost when the master repeats a transaction, it must not be applied twice. */
+    if (!repeated) {
+        if (transaction->initiator2target_buffer_size) {
+            memcpy(split_trans_initiator2target_buffer(transaction), request, request_length);
+        }
+        if (transaction->slave_callback) {
+            transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->target2initiator_buffer_size, split_trans_target2initiator_buffer(transaction));
+        }
+    }
+
+    if (transaction->target2initiator_buffer_size) {
+        memcpy(response, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+    }
+    *response_length = transaction->target2initiator_buffer_size;
+    return true;
+}
+
+/**
+ * @brief This thread runs on the slave and feeds the received frames to the pipeline.
+ */
+static THD_WORKING_AREA(waSlaveThread, 1024);
+static THD_FUNCTION(SlaveThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_protocol_tx_rx");
+
+    while (true) {
+        uint8_t byte;
+        /* Wait until something arrives, then take everything else that already has. */
+        if (likely(serial_transport_receive_blocking(&byte, sizeof(byte)))) {
+            serial_pipeline_receive(&pipeline, &byte, sizeof(byte));
+            serial_pipeline_poll(&pipeline);
+        }
+    }
+}
+
+/**
+ * @brief Slave specific initializations.
+ */
+void soft_serial_target_init(void) {
+    serial_transport_driver_slave_init();
+    serial_pipeline_init_slave(&pipeline, &pipeline_io, react_to_transaction);
+
+    /* Start transport thread. */
+    chThdCreateStatic(waSlaveThread, sizeof(waSlaveThread), HIGHPRIO, SlaveThread, NULL);
+}
+
+/**
+ * @brief Master specific initializations.
+ */
+void soft_serial_initiator_init(void) {
+    serial_transport_driver_master_init();
+    serial_pipeline_init_master(&pipeline, &pipeline_io);
+}
+
+/**
+ * @brief Start transaction from the master half to the slave half. Writes return as soon as they
+ * are queued, while the earlier ones may still be on their way.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @return bool Indicates success of transaction, or failure of an earlier write.
+ */
+bool soft_serial_transaction(int index) {
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(index >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t* transaction = &split_transaction_table[index];
+    if (unlikely(!serial_pipeline_transaction(&pipeline, (uint8_t)index, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        serial_dprintf("SPLIT: pipelined transaction failed\n");
+        return false;
+    }
+    return true;
+}
+
+#endif // defined(SERIAL_USART_PIPELINE)
@@ -83,12 +83,7 @@ void ws2812_init(void) {
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
-#if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
-#endif
+    ws2812_update_led(ws2812_leds, index, red, green, blue);
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -98,10 +93,16 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+    // LEDs after the last changed one keep their color
+    ws2812_dirty_range_t dirty = ws2812_take_dirty_range();
+    if (dirty.end == 0) {
+        return;
+    }
+
     // this code is very time dependent, so we need to disable interrupts
     chSysLock();
 
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+    for (int i = 0; i < dirty.end; i++) {
         // WS2812 protocol dictates grb order
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
         sendByte(ws2812_leds[i].g);
@@ -225,12 +225,7 @@ void ws2812_init(void) {
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
-#if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
-#endif
+    ws2812_update_led(ws2812_leds, index, red, green, blue);
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -240,7 +235,15 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+    ws2812_dirty_range_t dirty = ws2812_take_dirty_range();
+#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+    if (dirty.end == 0) {
+        return;
+    }
+#endif
+
+    // LEDs outside the dirty range are still encoded in txbuf from the last flush
+    for (int i = dirty.first; i < dirty.end; i++) {
         set_led_color_rgb(ws2812_leds[i], i);
     }
 
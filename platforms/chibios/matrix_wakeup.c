@@ -0,0 +1,37 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix.h"
+
+#if defined(MATRIX_EDGE_WAKEUP) && (PAL_USE_CALLBACKS == TRUE)
+
+/* Edge detection for parked matrix inputs through PAL line events.
+ *
+ * Note that on STM32 all ports share one EXTI channel per pin number, so input
+ * pins must not share a pin number (e.g. A1 and B1) for this to work.
+ */
+
+static volatile bool wakeup_pending = false;
+
+static void matrix_wakeup_callback(void *arg) {
+    wakeup_pending = true;
+}
+
+void matrix_wakeup_enable(pin_t pin) {
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, matrix_wakeup_callback, NULL);
+}
+
+void matrix_wakeup_disable(pin_t pin) {
+    palDisableLineEvent(pin);
+}
+
+bool matrix_wakeup_pending(void) {
+    osalSysLock();
+    bool pending   = wakeup_pending;
+    wakeup_pending = false;
+    osalSysUnlock();
+    return pending;
+}
+
+#endif
@@ -18,78 +18,121 @@
 
 static uint8_t buffer[TOTAL_EEPROM_BYTE_COUNT];
 
-uint8_t eeprom_read_byte(const uint8_t *addr) {
+// Each call counts as one transaction, as it would be on a bus attached EEPROM. Updates read first, and
+// only write if anything changed.
+static uint32_t read_transactions  = 0;
+static uint32_t write_transactions = 0;
+
+uint32_t eeprom_read_transaction_count(void) {
+    return read_transactions;
+}
+
+uint32_t eeprom_write_transaction_count(void) {
+    return write_transactions;
+}
+
+void reset_eeprom_transaction_counts(void) {
+    read_transactions  = 0;
+    write_transactions = 0;
+}
+
+static uint8_t read_byte(const uint8_t *addr) {
     uintptr_t offset = (uintptr_t)addr;
     return buffer[offset];
 }
 
-void eeprom_write_byte(uint8_t *addr, uint8_t value) {
+static void write_byte(uint8_t *addr, uint8_t value) {
     uintptr_t offset = (uintptr_t)addr;
     buffer[offset]   = value;
 }
 
+static void write_block(const void *buf, void *addr, size_t len) {
+    uint8_t *      p   = (uint8_t *)addr;
+    const uint8_t *src = (const uint8_t *)buf;
+    while (len--) {
+        write_byte(p++, *src++);
+    }
+}
+
+static void update_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *p   = (const uint8_t *)addr;
+    const uint8_t *src = (const uint8_t *)buf;
+    read_transactions++;
+    for (size_t i = 0; i < len; i++) {
+        if (read_byte(p + i) != src[i]) {
+            write_transactions++;
+            write_block(buf, addr, len);
+            return;
+        }
+    }
+}
+
+uint8_t eeprom_read_byte(const uint8_t *addr) {
+    read_transactions++;
+    return read_byte(addr);
+}
+
+void eeprom_write_byte(uint8_t *addr, uint8_t value) {
+    write_transactions++;
+    write_byte(addr, value);
+}
+
 uint16_t eeprom_read_word(const uint16_t *addr) {
     const uint8_t *p = (const uint8_t *)addr;
-    return eeprom_read_byte(p) | (eeprom_read_byte(p + 1) << 8);
+    read_transactions++;
+    return read_byte(p) | (read_byte(p + 1) << 8);
 }
 
 uint32_t eeprom_read_dword(const uint32_t *addr) {
     const uint8_t *p = (const uint8_t *)addr;
-    return eeprom_read_byte(p) | (eeprom_read_byte(p + 1) << 8) | (eeprom_read_byte(p + 2) << 16) | (eeprom_read_byte(p + 3) << 24);
+    read_transactions++;
+    return read_byte(p) | (read_byte(p + 1) << 8) | (read_byte(p + 2) << 16) | (read_byte(p + 3) << 24);
 }
 
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
     const uint8_t *p    = (const uint8_t *)addr;
     uint8_t *      dest = (uint8_t *)buf;
+    read_transactions++;
     while (len--) {
-        *dest++ = eeprom_read_byte(p++);
+        *dest++ = read_byte(p++);
     }
 }
 
 void eeprom_write_word(uint16_t *addr, uint16_t value) {
     uint8_t *p = (uint8_t *)addr;
-    eeprom_write_byte(p++, value);
-    eeprom_write_byte(p, value >> 8);
+    write_transactions++;
+    write_byte(p++, value);
+    write_byte(p, value >> 8);
 }
 
 void eeprom_write_dword(uint32_t *addr, uint32_t value) {
     uint8_t *p = (uint8_t *)addr;
-    eeprom_write_byte(p++, value);
-    eeprom_write_byte(p++, value >> 8);
-    eeprom_write_byte(p++, value >> 16);
-    eeprom_write_byte(p, value >> 24);
+    write_transactions++;
+    write_byte(p++, value);
+    write_byte(p++, value >> 8);
+    write_byte(p++, value >> 16);
+    write_byte(p, value >> 24);
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    uint8_t *      p   = (uint8_t *)addr;
-    const uint8_t *src = (const uint8_t *)buf;
-    while (len--) {
-        eeprom_write_byte(p++, *src++);
-    }
+    write_transactions++;
+    write_block(buf, addr, len);
 }
 
 void eeprom_update_byte(uint8_t *addr, uint8_t value) {
-    eeprom_write_byte(addr, value);
+    update_block(&value, addr, 1);
 }
 
 void eeprom_update_word(uint16_t *addr, uint16_t value) {
-    uint8_t *p = (uint8_t *)addr;
-    eeprom_write_byte(p++, value);
-    eeprom_write_byte(p, value >> 8);
+    uint8_t bytes[2] = {value, value >> 8};
+    update_block(bytes, addr, sizeof(bytes));
 }
 
 void eeprom_update_dword(uint32_t *addr, uint32_t value) {
-    uint8_t *p = (uint8_t *)addr;
-    eeprom_write_byte(p++, value);
-    eeprom_write_byte(p++, value >> 8);
-    eeprom_write_byte(p++, value >> 16);
-    eeprom_write_byte(p, value >> 24);
+    uint8_t bytes[4] = {value, value >> 8, value >> 16, value >> 24};
+    update_block(bytes, addr, sizeof(bytes));
 }
 
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
-    uint8_t *      p   = (uint8_t *)addr;
-    const uint8_t *src = (const uint8_t *)buf;
-    while (len--) {
-        eeprom_write_byte(p++, *src++);
-    }
+    update_block(buf, addr, len);
 }
@@ -0,0 +1,17 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 5
+
+#define MATRIX_ROW_PINS \
+    { 0, 1, 2, 3 }
+#define MATRIX_COL_PINS \
+    { 4, 5, 6, 7, 8 }
+#define DIODE_DIRECTION COL2ROW
+
+#define MATRIX_EDGE_WAKEUP
+
+#include "matrix_gpio_mock.h"
@@ -0,0 +1,100 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "matrix_wakeup.h"
+}
+
+class MatrixEdgeWakeup : public ::testing::Test {
+   protected:
+    const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+    void SetUp() override {
+        mock_matrix_reset();
+        matrix_init();
+        // The first scan finds an idle matrix and parks it.
+        matrix_scan();
+        mock_gpio_reset_read_count();
+    }
+
+    bool parked() {
+        for (pin_t pin : col_pins) {
+            if (!matrix_wakeup_is_armed(pin)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(MatrixEdgeWakeup, IdleScansReadNoPins) {
+    EXPECT_TRUE(parked());
+    for (int i = 0; i < 100; i++) {
+        EXPECT_FALSE(matrix_scan());
+    }
+    EXPECT_EQ(mock_gpio_read_count(), 0);
+}
+
+TEST_F(MatrixEdgeWakeup, PressIsReportedOnTheFirstScan) {
+    mock_matrix_press(2, 3);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_TRUE(matrix_is_on(2, 3));
+    EXPECT_FALSE(parked());
+}
+
+TEST_F(MatrixEdgeWakeup, FullScansWhileHeldAndParksAfterRelease) {
+    mock_matrix_press(0, 0);
+    EXPECT_TRUE(matrix_scan());
+    mock_gpio_reset_read_count();
+
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(mock_gpio_read_count(), MATRIX_ROWS * MATRIX_COLS);
+    EXPECT_TRUE(matrix_is_on(0, 0));
+
+    mock_matrix_release(0, 0);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_FALSE(matrix_is_on(0, 0));
+    EXPECT_TRUE(parked());
+
+    mock_gpio_reset_read_count();
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(mock_gpio_read_count(), 0);
+}
+
+TEST_F(MatrixEdgeWakeup, RolloverKeepsScanning) {
+    mock_matrix_press(0, 0);
+    EXPECT_TRUE(matrix_scan());
+    mock_matrix_press(1, 1);
+    EXPECT_TRUE(matrix_scan());
+    mock_matrix_release(0, 0);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_FALSE(parked());
+    EXPECT_TRUE(matrix_is_on(1, 1));
+    EXPECT_FALSE(matrix_is_on(0, 0));
+
+    mock_matrix_release(1, 1);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_TRUE(parked());
+}
+
+TEST_F(MatrixEdgeWakeup, SameColumnPressIsNotMissed) {
+    // A second key on an already low column produces no edge, it has to be
+    // picked up by the full scans that run while the first key is held.
+    mock_matrix_press(0, 2);
+    EXPECT_TRUE(matrix_scan());
+    mock_matrix_press(3, 2);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_TRUE(matrix_is_on(3, 2));
+}
+
+TEST_F(MatrixEdgeWakeup, BounceWithoutActiveInputStaysParked) {
+    mock_matrix_press(1, 4);
+    mock_matrix_release(1, 4);
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_TRUE(parked());
+    // Only the sense inputs were read to confirm the edge.
+    EXPECT_EQ(mock_gpio_read_count(), MATRIX_COLS);
+}
@@ -0,0 +1,92 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix.h"
+#include "matrix_wakeup.h"
+
+/* COL2ROW wiring: row pins drive, column pins sense through the key switches. */
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+static bool     pin_is_output[MATRIX_WAKEUP_SIMULATED_PINS];
+static bool     pin_level[MATRIX_WAKEUP_SIMULATED_PINS];
+static bool     keys[MATRIX_ROWS][MATRIX_COLS];
+static uint32_t read_count = 0;
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+void matrix_output_select_delay(void) {}
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+void matrix_init_kb(void) {}
+void matrix_scan_kb(void) {}
+
+bool matrix_is_on(uint8_t row, uint8_t col) {
+    return (matrix[row] & ((matrix_row_t)1 << col));
+}
+
+void mock_gpio_set_pin_output(pin_t pin) {
+    pin_is_output[pin] = true;
+}
+
+void mock_gpio_set_pin_input_high(pin_t pin) {
+    pin_is_output[pin] = false;
+    pin_level[pin]     = true;
+}
+
+void mock_gpio_write_pin(pin_t pin, bool level) {
+    pin_level[pin] = level;
+}
+
+static bool col_level(uint8_t col) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        pin_t row_pin = row_pins[row];
+        if (keys[row][col] && pin_is_output[row_pin] && !pin_level[row_pin]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool mock_gpio_read_pin(pin_t pin) {
+    read_count++;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] == pin) {
+            return col_level(col);
+        }
+    }
+    return pin_level[pin];
+}
+
+static void set_key(uint8_t row, uint8_t col, bool pressed) {
+    bool before    = col_level(col);
+    keys[row][col] = pressed;
+    if (col_level(col) != before) {
+        matrix_wakeup_simulate_edge(col_pins[col]);
+    }
+}
+
+void mock_matrix_press(uint8_t row, uint8_t col) {
+    set_key(row, col, true);
+}
+
+void mock_matrix_release(uint8_t row, uint8_t col) {
+    set_key(row, col, false);
+}
+
+void mock_matrix_reset(void) {
+    memset(keys, 0, sizeof(keys));
+    memset(pin_is_output, 0, sizeof(pin_is_output));
+    memset(pin_level, 0, sizeof(pin_level));
+    read_count = 0;
+}
+
+uint32_t mock_gpio_read_count(void) {
+    return read_count;
+}
+
+void mock_gpio_reset_read_count(void) {
+    read_count = 0;
+}
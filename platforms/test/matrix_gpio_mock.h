@@ -0,0 +1,36 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Simulated key matrix wired to mock GPIO, pins are indices into a pin table. */
+
+typedef uint8_t pin_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void mock_gpio_set_pin_output(pin_t pin);
+void mock_gpio_set_pin_input_high(pin_t pin);
+void mock_gpio_write_pin(pin_t pin, bool level);
+bool mock_gpio_read_pin(pin_t pin);
+
+void     mock_matrix_reset(void);
+void     mock_matrix_press(uint8_t row, uint8_t col);
+void     mock_matrix_release(uint8_t row, uint8_t col);
+uint32_t mock_gpio_read_count(void);
+void     mock_gpio_reset_read_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define gpio_set_pin_output(pin) mock_gpio_set_pin_output(pin)
+#define gpio_set_pin_input_high(pin) mock_gpio_set_pin_input_high(pin)
+#define gpio_write_pin_low(pin) mock_gpio_write_pin((pin), false)
+#define gpio_write_pin_high(pin) mock_gpio_write_pin((pin), true)
+#define gpio_read_pin(pin) mock_gpio_read_pin(pin)
@@ -0,0 +1,37 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_wakeup.h"
+
+#ifdef MATRIX_EDGE_WAKEUP
+
+/* Simulated pin-change detection for the unit-test build. */
+
+static bool armed[MATRIX_WAKEUP_SIMULATED_PINS] = {0};
+static bool pending                            = false;
+
+void matrix_wakeup_enable(pin_t pin) {
+    armed[pin] = true;
+}
+
+void matrix_wakeup_disable(pin_t pin) {
+    armed[pin] = false;
+}
+
+bool matrix_wakeup_pending(void) {
+    bool was_pending = pending;
+    pending          = false;
+    return was_pending;
+}
+
+void matrix_wakeup_simulate_edge(pin_t pin) {
+    if (armed[pin]) {
+        pending = true;
+    }
+}
+
+bool matrix_wakeup_is_armed(pin_t pin) {
+    return armed[pin];
+}
+
+#endif
@@ -0,0 +1,23 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include "matrix.h"
+
+#ifndef MATRIX_WAKEUP_SIMULATED_PINS
+#    define MATRIX_WAKEUP_SIMULATED_PINS 32
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Simulates an edge on an input, latched only if the pin is armed. */
+void matrix_wakeup_simulate_edge(pin_t pin);
+bool matrix_wakeup_is_armed(pin_t pin);
+
+#ifdef __cplusplus
+}
+#endif
@@ -23,3 +23,14 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+matrix_edge_wakeup_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_edge_wakeup_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_edge_wakeup_config.h
+matrix_edge_wakeup_INC := $(PLATFORM_PATH)/$(PLATFORM_KEY)
+
+matrix_edge_wakeup_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_gpio_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_wakeup.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_edge_wakeup_tests.cpp
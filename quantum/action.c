@@ -534,6 +534,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("MODS_TAP: Tap: unregister_code\n");
+                            host_keyboard_flush();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -715,6 +716,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                            host_keyboard_flush();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -732,6 +734,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         register_code(action.layer_tap.code);
                     } else {
                         ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                        host_keyboard_flush();
                         if (action.layer_tap.code == KC_CAPS) {
                             wait_ms(TAP_HOLD_CAPS_DELAY);
                         } else {
@@ -805,6 +808,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         if (event.pressed) {
                             register_code(action.swap.code);
                         } else {
+                            host_keyboard_flush();
                             wait_ms(TAP_CODE_DELAY);
                             unregister_code(action.swap.code);
                             *record = (keyrecord_t){}; // hack: reset tap mode
@@ -871,8 +875,10 @@ void process_action(keyrecord_t *record, action_t action) {
                     process_auto_shift(action.layer_tap.code, record);
 #        else
                     register_mods(retro_tap_curr_mods);
+                    host_keyboard_flush();
                     wait_ms(TAP_CODE_DELAY);
                     tap_code(action.layer_tap.code);
+                    host_keyboard_flush();
                     wait_ms(TAP_CODE_DELAY);
                     unregister_mods(retro_tap_curr_mods);
 #        endif
@@ -924,6 +930,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_CAPS_LOCK);
         send_keyboard_report();
+        host_keyboard_flush();
         wait_ms(TAP_HOLD_CAPS_DELAY);
         del_key(KC_CAPS_LOCK);
         send_keyboard_report();
@@ -934,6 +941,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_NUM_LOCK);
         send_keyboard_report();
+        host_keyboard_flush();
         wait_ms(100);
         del_key(KC_NUM_LOCK);
         send_keyboard_report();
@@ -944,6 +952,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_SCROLL_LOCK);
         send_keyboard_report();
+        host_keyboard_flush();
         wait_ms(100);
         del_key(KC_SCROLL_LOCK);
         send_keyboard_report();
@@ -1041,7 +1050,12 @@ __attribute__((weak)) void unregister_code(uint8_t code) {
  * \param delay The amount of time in milliseconds to leave the keycode registered, before unregistering it.
  */
 __attribute__((weak)) void tap_code_delay(uint8_t code, uint16_t delay) {
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_NONBLOCKING)
+    // Type out queued strings first, or the tap would overtake them
+    send_string_flush();
+#endif
     register_code(code);
+    host_keyboard_flush();
     wait_ms(delay);
     unregister_code(code);
 }
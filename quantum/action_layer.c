@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -11,6 +12,10 @@
  */
 layer_state_t default_layer_state = 0;
 
+#if defined(LAYER_LOOKUP_CACHE) && !defined(NO_ACTION_LAYER)
+static void layer_lookup_cache_sync(void);
+#endif
+
 /** \brief Default Layer State Set At user Level
  *
  * Run user code on default layer state change
@@ -48,6 +53,9 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     ac_dprintf("\n");
+#if defined(LAYER_LOOKUP_CACHE) && !defined(NO_ACTION_LAYER)
+    layer_lookup_cache_sync();
+#endif
 #if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -138,6 +146,9 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     ac_dprintf("\n");
+#    ifdef LAYER_LOOKUP_CACHE
+    layer_lookup_cache_sync();
+#    endif
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -308,6 +319,57 @@ uint8_t read_source_layers_cache(keypos_t key) {
 }
 #endif
 
+#if defined(LAYER_LOOKUP_CACHE) && !defined(NO_ACTION_LAYER)
+/** \brief resolved layers cache
+ *
+ * Holds the topmost non-transparent layer of every key plus one, zero marks
+ * an entry which has to be resolved again on the next lookup.
+ */
+static uint8_t       layer_lookup_cache[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+static layer_state_t layer_lookup_cache_state                     = 0;
+
+/** \brief sync resolved layers cache
+ *
+ * A key resolved to layer n is only affected by changes to layers n and
+ * above, so only those entries are marked stale when the layer state changes.
+ */
+static void layer_lookup_cache_sync(void) {
+    const layer_state_t layers  = layer_state | default_layer_state;
+    const layer_state_t changed = layers ^ layer_lookup_cache_state;
+    if (!changed) {
+        return;
+    }
+
+    const uint8_t highest_changed = get_highest_layer(changed);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (layer_lookup_cache[row][col] <= highest_changed + 1) {
+                layer_lookup_cache[row][col] = 0;
+            }
+        }
+    }
+    layer_lookup_cache_state = layers;
+}
+
+/** \brief clear resolved layers cache
+ *
+ * Marks all keys as stale
+ */
+void layer_lookup_cache_clear(void) {
+    memset(layer_lookup_cache, 0, sizeof(layer_lookup_cache));
+}
+
+/** \brief clear resolved layers cache for a key
+ *
+ * Marks a single key as stale
+ */
+void layer_lookup_cache_clear_key(keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layer_lookup_cache[key.row][key.col] = 0;
+    }
+}
+#endif
+
 /** \brief Store or get action (FIXME: Needs better summary)
  *
  * Make sure the action triggered when the key is released is the same
@@ -339,8 +401,8 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
  *
  * Gets the layer based on key info
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
+static uint8_t layer_switch_resolve_layer(keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
@@ -356,6 +418,24 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+#    ifdef LAYER_LOOKUP_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        // layer_state may have been written directly, e.g. by split transactions
+        layer_lookup_cache_sync();
+
+        uint8_t *entry = &layer_lookup_cache[key.row][key.col];
+        if (*entry == 0) {
+            *entry = layer_switch_resolve_layer(key) + 1;
+        }
+        return *entry - 1;
+    }
+#    endif
+    return layer_switch_resolve_layer(key);
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -166,6 +166,23 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+/* resolved layers cache */
+#if defined(LAYER_LOOKUP_CACHE) && !defined(NO_ACTION_LAYER)
+/**
+ * @brief Marks the resolved layer of all keys as stale, must be called when
+ * the keymap is changed at runtime.
+ */
+void layer_lookup_cache_clear(void);
+
+/**
+ * @brief Marks the resolved layer of a single key as stale.
+ */
+void layer_lookup_cache_clear_key(keypos_t key);
+#else
+#    define layer_lookup_cache_clear()
+#    define layer_lookup_cache_clear_key(key) (void)key
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
@@ -0,0 +1,5 @@
+audio_wavetable_INC := $(QUANTUM_PATH)/audio
+
+audio_wavetable_SRC := \
+	$(QUANTUM_PATH)/audio/tests/wavetable_tests.cpp \
+	$(QUANTUM_PATH)/audio/wavetable.c
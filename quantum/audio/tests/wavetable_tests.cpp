@@ -0,0 +1,131 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "wavetable.h"
+}
+
+/*
+    The golden buffers were generated independently of wavetable.c, by a model of the same
+    fixed-point synthesis: 32-bit phase accumulators indexed by their top bits, with the
+    increment computed in single precision, at the additive DAC driver's default sample rate
+    of 44100 * 3 / 2.
+*/
+
+namespace {
+
+const uint32_t sample_rate = 44100 * 3 / 2;
+
+// clang-format off
+static const uint16_t golden_sine_a4[] = {
+    1, 6, 15, 22, 39, 61, 74, 103, 137, 176, 197, 242,
+    291, 318, 373, 433, 465, 530, 600, 672, 710, 788, 869, 910,
+    995, 1082, 1127, 1218, 1311, 1405, 1453, 1550, 1648, 1697, 1797, 1897,
+    1997, 2048, 2148, 2248, 2298, 2398, 2496, 2545, 2642, 2737, 2831, 2877,
+};
+
+static const uint16_t golden_sine_c_major[] = {
+    1, 3, 7, 15, 22, 34, 43, 62, 75, 95, 116, 140,
+    159, 187, 215, 247, 271, 307, 343, 381, 411, 464, 495, 541,
+    575, 636, 671, 723, 761, 828, 884, 924, 996, 1038, 1097, 1142,
+    1218, 1263, 1325, 1387, 1450, 1497, 1562, 1626, 1690, 1739, 1804, 1869,
+};
+
+static const uint16_t golden_sine_a4_to_a5[] = {
+    1, 6, 15, 22, 39, 61, 74, 103, 137, 176, 197, 242,
+    291, 318, 373, 433, 465, 530, 600, 672, 710, 788, 869, 910,
+    1082, 1218, 1405, 1550, 1697, 1897, 2048, 2248, 2398, 2545, 2737, 2877,
+    3057, 3185, 3307, 3459, 3565, 3692, 3777, 3853, 3939, 3992, 4045, 4073,
+};
+
+static const uint16_t golden_triangle_1khz[] = {
+    96, 224, 352, 480, 608, 736, 864, 960, 1088, 1216, 1344, 1472,
+    1600, 1728, 1856, 1952, 2079, 2207, 2335, 2463, 2591, 2719, 2847, 2943,
+    3071, 3199, 3327, 3455, 3583, 3711, 3807, 3935, 4063, 3999, 3871, 3743,
+    3615, 3487, 3391, 3263, 3135, 3007, 2879, 2751, 2623, 2495, 2399, 2271,
+};
+// clang-format on
+
+std::vector<uint16_t> generate(const wavetable_t *table, wavetable_tone_t *tones, uint8_t count, size_t length) {
+    std::vector<uint16_t> samples;
+    for (size_t i = 0; i < length; i++) {
+        samples.push_back(wavetable_mix(table, tones, count));
+    }
+    return samples;
+}
+
+template <size_t N>
+std::vector<uint16_t> golden(const uint16_t (&samples)[N]) {
+    return std::vector<uint16_t>(samples, samples + N);
+}
+
+} // namespace
+
+class Wavetable : public ::testing::Test {};
+
+TEST_F(Wavetable, SingleTone_MatchesGolden) {
+    wavetable_tone_t tone = {};
+    wavetable_tone_set_frequency(&tone, 440.0f, sample_rate);
+    EXPECT_EQ(generate(&wavetable_sine, &tone, 1, 48), golden(golden_sine_a4));
+}
+
+TEST_F(Wavetable, Chord_MatchesGolden) {
+    wavetable_tone_t tones[3] = {};
+    wavetable_tone_set_frequency(&tones[0], 261.63f, sample_rate);
+    wavetable_tone_set_frequency(&tones[1], 329.63f, sample_rate);
+    wavetable_tone_set_frequency(&tones[2], 392.0f, sample_rate);
+    EXPECT_EQ(generate(&wavetable_sine, tones, 3, 48), golden(golden_sine_c_major));
+}
+
+TEST_F(Wavetable, FrequencyChange_KeepsPhase) {
+    wavetable_tone_t      tone = {};
+    std::vector<uint16_t> samples;
+
+    wavetable_tone_set_frequency(&tone, 440.0f, sample_rate);
+    samples = generate(&wavetable_sine, &tone, 1, 24);
+    wavetable_tone_set_frequency(&tone, 880.0f, sample_rate);
+    std::vector<uint16_t> rest = generate(&wavetable_sine, &tone, 1, 24);
+    samples.insert(samples.end(), rest.begin(), rest.end());
+
+    EXPECT_EQ(samples, golden(golden_sine_a4_to_a5));
+}
+
+TEST_F(Wavetable, Triangle_MatchesGolden) {
+    wavetable_tone_t tone = {};
+    wavetable_tone_set_frequency(&tone, 1000.0f, sample_rate);
+    EXPECT_EQ(generate(&wavetable_triangle, &tone, 1, 48), golden(golden_triangle_1khz));
+}
+
+TEST_F(Wavetable, OneSecond_HasTheRightNumberOfPeriods) {
+    const float frequencies[] = {65.41f, 440.0f, 1046.5f, 7902.13f};
+
+    for (float frequency : frequencies) {
+        wavetable_tone_t tone = {};
+        wavetable_tone_set_frequency(&tone, frequency, sample_rate);
+
+        // Each period rises through the midpoint once
+        unsigned periods = 0;
+        uint16_t last    = wavetable_mix(&wavetable_sine, &tone, 1);
+        for (uint32_t i = 1; i < sample_rate; i++) {
+            uint16_t sample = wavetable_mix(&wavetable_sine, &tone, 1);
+            if (last < 0x800 && sample >= 0x800) {
+                periods++;
+            }
+            last = sample;
+        }
+        EXPECT_NEAR(periods, frequency, 1.0) << "at " << frequency << "Hz";
+    }
+}
+
+TEST_F(Wavetable, Silence_DoesNotAdvance) {
+    wavetable_tone_t tone = {.phase = 0x12345678, .increment = 1};
+    wavetable_tone_set_frequency(&tone, 0.0f, sample_rate);
+    EXPECT_EQ(tone.increment, 0);
+
+    uint16_t sample = wavetable_mix(&wavetable_sine, &tone, 1);
+    EXPECT_EQ(tone.phase, 0x12345678);
+    EXPECT_EQ(wavetable_mix(&wavetable_sine, &tone, 1), sample);
+}
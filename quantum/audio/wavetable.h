@@ -0,0 +1,31 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+  Fixed-point additive synthesis from pre-baked wavetables, as used by the additive DAC driver.
+
+  Each tone keeps a 32-bit phase, where the full range is one period of the waveform, and the
+  top bits of the phase index the table. Frequencies are turned into phase increments once, when
+  the playing tones change, so generating samples from the DAC buffer callback is integer only.
+*/
+
+typedef struct {
+    const uint16_t *samples;
+    uint8_t         length_bits; // the table holds 1 << length_bits samples
+} wavetable_t;
+
+typedef struct {
+    uint32_t phase;
+    uint32_t increment;
+} wavetable_tone_t;
+
+extern const wavetable_t wavetable_sine;
+extern const wavetable_t wavetable_triangle;
+extern const wavetable_t wavetable_trapezoid;
+
+void     wavetable_tone_set_frequency(wavetable_tone_t *tone, float frequency, uint32_t sample_rate);
+uint16_t wavetable_mix(const wavetable_t *table, wavetable_tone_t *tones, uint8_t count);
@@ -17,6 +17,7 @@
 #include "timer.h"
 #include "action.h"
 #include "action_util.h"
+#include "task_scheduler.h"
 
 /** @brief True when Caps Word is active. */
 static bool caps_word_active = false;
@@ -32,13 +33,21 @@ static bool caps_word_active = false;
 static uint16_t idle_timer = 0;
 
 void caps_word_task(void) {
-    if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
+    if (!caps_word_active) {
+        return;
+    }
+
+    uint16_t now = timer_read();
+    if (timer_expired(now, idle_timer)) {
         caps_word_off();
+    } else {
+        task_schedule_in(SCHEDULED_TASK_CAPS_WORD, (uint16_t)(idle_timer - now));
     }
 }
 
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    task_schedule_in(SCHEDULED_TASK_CAPS_WORD, 0);
 }
 #else
 void caps_word_task(void) {}
@@ -0,0 +1,151 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm, behaves like sym_defer_pk.
+Instead of a counter for every key, a fixed pool of timers is assigned to the
+keys currently bouncing and a per-row mask tracks which keys own a timer. The
+cost of a scan therefore depends on the number of bouncing keys instead of
+the size of the matrix, which matters for large (split) matrices.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Number of keys that can bounce at the same time
+#ifndef DEBOUNCE_SPARSE_POOL_SIZE
+#    define DEBOUNCE_SPARSE_POOL_SIZE 16
+#endif
+
+#define ROW_SHIFTER ((matrix_row_t)1)
+
+#if DEBOUNCE > 0
+typedef struct {
+    uint8_t row;
+    uint8_t col;
+    uint8_t remaining;
+} debounce_timer_t;
+
+static debounce_timer_t debounce_timers[DEBOUNCE_SPARSE_POOL_SIZE];
+static uint8_t          active_count;
+static matrix_row_t     active_rows[MATRIX_ROWS]; // keys owning a timer
+static fast_timer_t     last_time;
+static bool             pool_exhausted;
+static bool             cooked_changed;
+
+static void update_timers_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time);
+static void start_timers(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+void debounce_init(uint8_t num_rows) {
+    active_count   = 0;
+    pool_exhausted = false;
+    for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+        active_rows[r] = 0;
+    }
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (active_count) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_timers_and_transfer_if_expired(raw, cooked, elapsed_time);
+        }
+    }
+
+    // keys which did not get a timer are retried until one frees up
+    if (changed || pool_exhausted) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_timers(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void release_timer(uint8_t index) {
+    active_rows[debounce_timers[index].row] &= ~(ROW_SHIFTER << debounce_timers[index].col);
+    debounce_timers[index] = debounce_timers[--active_count];
+}
+
+static void update_timers_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time) {
+    uint8_t i = 0;
+    while (i < active_count) {
+        debounce_timer_t *entry = &debounce_timers[i];
+        if (entry->remaining <= elapsed_time) {
+            const uint8_t      row         = entry->row;
+            const matrix_row_t mask        = ROW_SHIFTER << entry->col;
+            matrix_row_t       cooked_next = (cooked[row] & ~mask) | (raw[row] & mask);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+            release_timer(i); // moves the last timer into slot i
+        } else {
+            entry->remaining -= elapsed_time;
+            i++;
+        }
+    }
+}
+
+static void start_timers(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    pool_exhausted = false;
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        const matrix_row_t delta = raw[row] ^ cooked[row];
+
+        // keys back at their debounced state lose their timer
+        if (active_rows[row] & ~delta) {
+            for (uint8_t i = active_count; i-- > 0;) {
+                if (debounce_timers[i].row == row && !(delta & (ROW_SHIFTER << debounce_timers[i].col))) {
+                    release_timer(i);
+                }
+            }
+        }
+
+        // newly changed keys get one
+        matrix_row_t start = delta & ~active_rows[row];
+        for (uint8_t col = 0; start; col++, start >>= 1) {
+            if (!(start & 1)) {
+                continue;
+            }
+            if (active_count >= DEBOUNCE_SPARSE_POOL_SIZE) {
+                pool_exhausted = true;
+                break;
+            }
+            debounce_timers[active_count++] = (debounce_timer_t){
+                .row       = row,
+                .col       = col,
+                .remaining = DEBOUNCE,
+            };
+            active_rows[row] |= ROW_SHIFTER << col;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,60 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* Built with DEBOUNCE_SPARSE_POOL_SIZE=2, the sym_defer_pk tests are run as well. */
+
+TEST_F(DebounceTest, SparseFarCorner) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{15, 23, DOWN}}, {}},
+
+        {5, {}, {{15, 23, DOWN}}},
+        {6, {{15, 23, UP}}, {}},
+
+        {11, {}, {{15, 23, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, SparsePoolExhausted) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {7, 12, DOWN}, {15, 23, DOWN}}, {}},
+
+        /* The third key only gets a timer once the others expired */
+        {5, {}, {{0, 1, DOWN}, {7, 12, DOWN}}},
+        {10, {}, {{15, 23, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, SparsePoolExhaustedBounce) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {0, 2, DOWN}}, {}},
+        {1, {{3, 4, DOWN}}, {}},
+        /* Bounce returns key 0,1 to its debounced state and frees its timer */
+        {2, {{0, 1, UP}}, {}},
+
+        {5, {}, {{0, 2, DOWN}}},
+        {7, {}, {{3, 4, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, SparseBounceRestartsTimer) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{9, 20, DOWN}}, {}},
+        {3, {{9, 20, UP}}, {}},
+        {4, {{9, 20, DOWN}}, {}},
+
+        /* 5ms after the last change */
+        {9, {}, {{9, 20, DOWN}}},
+    });
+    runEvents();
+}
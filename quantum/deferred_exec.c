@@ -13,30 +13,118 @@
 // Helpers
 //
 
+/*
+  Each table is kept as a binary min-heap ordered by trigger time. The active executors are packed at
+  the start of the table with the next one due at index 0, and unused entries, with an invalid token,
+  follow them. A zero-initialised table is an empty heap.
+*/
+
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline bool triggers_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline void clear_entry(deferred_executor_t *entry) {
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+// Number of active executors, a binary search for the first unused entry
+static size_t active_count(deferred_executor_t *table, size_t table_count) {
+    size_t lo = 0;
+    size_t hi = table_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].token != INVALID_DEFERRED_TOKEN) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Moves the entry at index towards the root while it triggers before its parent, returning where it ended up
+static size_t sift_up(deferred_executor_t *table, size_t index) {
+    deferred_executor_t entry = table[index];
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!triggers_before(&entry, &table[parent])) {
+            break;
+        }
+        table[index] = table[parent];
+        index        = parent;
+    }
+    table[index] = entry;
+    return index;
+}
+
+// Moves the entry at index towards the leaves while one of its children triggers before it
+static void sift_down(deferred_executor_t *table, size_t count, size_t index) {
+    deferred_executor_t entry = table[index];
+    for (;;) {
+        size_t child = 2 * index + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && triggers_before(&table[child + 1], &table[child])) {
+            ++child;
+        }
+        if (!triggers_before(&table[child], &entry)) {
+            break;
+        }
+        table[index] = table[child];
+        index        = child;
+    }
+    table[index] = entry;
+}
+
+// Moves an entry whose trigger time has changed to its place in the heap
+static inline void reschedule_entry(deferred_executor_t *table, size_t count, size_t index) {
+    if (sift_up(table, index) == index) {
+        sift_down(table, count, index);
     }
-    for (int i = 0; i < table_count; ++i) {
+}
+
+static void remove_entry(deferred_executor_t *table, size_t count, size_t index) {
+    size_t last = count - 1;
+    if (index != last) {
+        table[index] = table[last];
+    }
+    clear_entry(&table[last]);
+    if (index != last) {
+        reschedule_entry(table, last, index);
+    }
+}
+
+static size_t find_entry(deferred_executor_t *table, size_t count, deferred_token token) {
+    for (size_t i = 0; i < count; ++i) {
         if (table[i].token == token) {
-            return false;
+            return i;
         }
     }
-    return true;
+    return count;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
+static deferred_token allocate_token(deferred_executor_t *table, size_t count) {
+    // One bit for each possible token, marking the ones in use by this table
+    uint8_t used[(1 << (8 * sizeof(deferred_token))) / 8] = {0};
+    for (size_t i = 0; i < count; ++i) {
+        used[table[i].token / 8] |= 1 << (table[i].token % 8);
+    }
+
+    for (size_t attempt = 0; attempt < 8 * sizeof(used); ++attempt) {
         ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+        if (current_token != INVALID_DEFERRED_TOKEN && !(used[current_token / 8] & (1 << (current_token % 8)))) {
+            return current_token;
         }
     }
-    return current_token;
+
+    // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
+    return INVALID_DEFERRED_TOKEN;
 }
 
 //------------------------------------
@@ -49,27 +137,26 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+    // Claim the first unused slot, if there is one
+    size_t count = active_count(table, table_count);
+    if (count == table_count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
 
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token(table, count);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry, and move it to its place in the heap
+    deferred_executor_t *entry = &table[count];
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    sift_up(table, count);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +166,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t count = active_count(table, table_count);
+    size_t index = find_entry(table, count, token);
+    if (index == count) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[index].trigger_time = timer_read32() + delay_ms;
+    reschedule_entry(table, count, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +185,23 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t count = active_count(table, table_count);
+    size_t index = find_entry(table, count, token);
+    if (index == count) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    remove_entry(table, count, index);
+    return true;
+}
+
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    *trigger_time = table[0].trigger_time;
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +211,43 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Run the executors that are due, earliest first. Each pass is limited to the number of executors, so
+        // one that keeps re-queueing itself in the past cannot hold up the rest of the main loop.
+        size_t count = active_count(table, table_count);
+        for (size_t runs = count; runs > 0; --runs) {
+            deferred_executor_t *entry      = &table[0];
             deferred_token       curr_token = entry->token;
+            if (curr_token == INVALID_DEFERRED_TOKEN || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // The callback may have queued, extended or cancelled executors, which moves entries around. Only
+            // count and search again if this entry is no longer at the root, or the number of executors changed.
+            size_t index = 0;
+            if (table[0].token != curr_token || table[count - 1].token == INVALID_DEFERRED_TOKEN || (count < table_count && table[count].token != INVALID_DEFERRED_TOKEN)) {
+                count = active_count(table, table_count);
+                index = find_entry(table, count, curr_token);
+            }
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // If the token is gone, then the callback has canceled (and possibly re-queued). Skip further processing.
+            if (index == count) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                table[index].trigger_time += delay_ms;
+                reschedule_entry(table, count, index);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                remove_entry(table, count, index);
             }
         }
     }
@@ -172,6 +269,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next_trigger(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next_trigger(basic_executors, MAX_DEFERRED_EXECUTORS, trigger_time);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
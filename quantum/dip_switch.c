@@ -65,6 +65,7 @@ __attribute__((weak)) bool dip_switch_update_mask_kb(uint32_t state) {
 #    include "keymap_introspection.h"
 #    include "action.h"
 #    include "wait.h"
+#    include "host.h"
 
 #    ifndef DIP_SWITCH_MAP_KEY_DELAY
 #        define DIP_SWITCH_MAP_KEY_DELAY TAP_CODE_DELAY
@@ -74,11 +75,13 @@ static void dip_switch_exec_mapping(uint8_t index, bool on) {
     // The delays below cater for Windows and its wonderful requirements.
     action_exec(on ? MAKE_DIPSWITCH_ON_EVENT(index, true) : MAKE_DIPSWITCH_OFF_EVENT(index, true));
 #    if DIP_SWITCH_MAP_KEY_DELAY > 0
+    host_keyboard_flush();
     wait_ms(DIP_SWITCH_MAP_KEY_DELAY);
 #    endif // DIP_SWITCH_MAP_KEY_DELAY > 0
 
     action_exec(on ? MAKE_DIPSWITCH_ON_EVENT(index, false) : MAKE_DIPSWITCH_OFF_EVENT(index, false));
 #    if DIP_SWITCH_MAP_KEY_DELAY > 0
+    host_keyboard_flush();
     wait_ms(DIP_SWITCH_MAP_KEY_DELAY);
 #    endif // DIP_SWITCH_MAP_KEY_DELAY > 0
 }
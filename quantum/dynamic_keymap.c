@@ -18,6 +18,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
@@ -32,25 +33,99 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// Copies of the stored keymap and encoder map, so that lookups never wait on the NVM. Writes go to both.
+static uint16_t keymap_mirror[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t encoder_mirror[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][2];
+#    endif // ENCODER_MAP_ENABLE
+static bool mirror_loaded = false;
+
+#    define KEYMAP_MIRROR_SIZE (sizeof(keymap_mirror))
+
+static void dynamic_keymap_mirror_load(void) {
+    // One bulk read of the stored keymap, which is big-endian, then swapped into place
+    uint8_t * raw      = (uint8_t *)keymap_mirror;
+    uint16_t *keycodes = (uint16_t *)keymap_mirror;
+    nvm_dynamic_keymap_read_buffer(0, KEYMAP_MIRROR_SIZE, raw);
+    for (uint32_t i = 0; i < KEYMAP_MIRROR_SIZE; i += 2) {
+        keycodes[i / 2] = (raw[i] << 8) | raw[i + 1];
+    }
+
+#    ifdef ENCODER_MAP_ENABLE
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            encoder_mirror[layer][encoder][0] = nvm_dynamic_keymap_read_encoder(layer, encoder, true);
+            encoder_mirror[layer][encoder][1] = nvm_dynamic_keymap_read_encoder(layer, encoder, false);
+        }
+    }
+#    endif // ENCODER_MAP_ENABLE
+
+    mirror_loaded = true;
+}
+
+// Byte of the mirror at the given offset, laid out as stored
+static inline uint8_t keymap_mirror_byte(uint32_t offset) {
+    uint16_t keycode = ((uint16_t *)keymap_mirror)[offset / 2];
+    return (offset & 1) ? (uint8_t)(keycode & 0xFF) : (uint8_t)(keycode >> 8);
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_load();
+#endif
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    if (!mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+    return keymap_mirror[layer][row][column];
+#else
     return nvm_dynamic_keymap_read_keycode(layer, row, column);
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (mirror_loaded && layer < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        keymap_mirror[layer][row][column] = keycode;
+    }
+#endif
+#ifdef LAYER_LOOKUP_CACHE
+    keypos_t key = {.row = row, .col = column};
+    layer_lookup_cache_clear_key(key);
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+    if (!mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+    return encoder_mirror[layer][encoder_id][clockwise ? 0 : 1];
+#    else
     return nvm_dynamic_keymap_read_encoder(layer, encoder_id, clockwise);
+#    endif
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     nvm_dynamic_keymap_update_encoder(layer, encoder_id, clockwise, keycode);
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (mirror_loaded && layer < DYNAMIC_KEYMAP_LAYER_COUNT && encoder_id < NUM_ENCODERS) {
+        encoder_mirror[layer][encoder_id][clockwise ? 0 : 1] = keycode;
+    }
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -72,14 +147,37 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+    layer_lookup_cache_clear();
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (!mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        data[i] = (offset + i < KEYMAP_MIRROR_SIZE) ? keymap_mirror_byte(offset + i) : 0x00;
+    }
+#else
     nvm_dynamic_keymap_read_buffer(offset, size, data);
+#endif
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (mirror_loaded) {
+        for (uint32_t i = 0; i < size && offset + i < KEYMAP_MIRROR_SIZE; i++) {
+            uint16_t *keycode = &((uint16_t *)keymap_mirror)[(offset + i) / 2];
+            if ((offset + i) & 1) {
+                *keycode = (*keycode & 0xFF00) | data[i];
+            } else {
+                *keycode = (*keycode & 0x00FF) | (data[i] << 8);
+            }
+        }
+    }
+#endif
+    layer_lookup_cache_clear();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -5,6 +5,8 @@
 #include "action.h"
 #include "encoder.h"
 #include "wait.h"
+#include "host.h"
+#include "compiler_support.h"
 
 #ifndef ENCODER_MAP_KEY_DELAY
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
@@ -16,15 +18,63 @@ __attribute__((weak)) bool should_process_encoder(void) {
 
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
+static uint8_t          drain_dequeued     = 0;
+static uint16_t         queue_overflows    = 0;
+
+#ifdef ENCODER_INTERRUPT_CAPTURE
+STATIC_ASSERT(ENCODER_CAPTURE_QUEUE_SIZE <= 128 && (ENCODER_CAPTURE_QUEUE_SIZE & (ENCODER_CAPTURE_QUEUE_SIZE - 1)) == 0, "ENCODER_CAPTURE_QUEUE_SIZE must be a power of two, up to 128");
+
+// Single producer (interrupt handler), single consumer (encoder_task) queue. The
+// head is only written by the producer and the tail only by the consumer; both
+// count up freely and are reduced to an index on access.
+static encoder_event_t   capture_queue[ENCODER_CAPTURE_QUEUE_SIZE];
+static uint8_t           capture_head      = 0;
+static uint8_t           capture_tail      = 0;
+static volatile uint16_t capture_overflows = 0;
+
+bool encoder_capture_event(uint8_t index, bool clockwise) {
+    uint8_t head = capture_head;
+    if ((uint8_t)(head - __atomic_load_n(&capture_tail, __ATOMIC_ACQUIRE)) == ENCODER_CAPTURE_QUEUE_SIZE) {
+        capture_overflows++;
+        return false;
+    }
+
+    capture_queue[head % ENCODER_CAPTURE_QUEUE_SIZE] = (encoder_event_t){.index = index, .clockwise = clockwise ? 1 : 0};
+    __atomic_store_n(&capture_head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+static void encoder_capture_drain(void) {
+    uint8_t tail = capture_tail;
+    uint8_t head = __atomic_load_n(&capture_head, __ATOMIC_ACQUIRE);
+
+    // Events which don't fit yet stay in the capture queue until the next task
+    while (tail != head && !encoder_queue_full()) {
+        encoder_event_t event = capture_queue[tail % ENCODER_CAPTURE_QUEUE_SIZE];
+        encoder_queue_event(event.index, event.clockwise);
+        tail++;
+    }
+    __atomic_store_n(&capture_tail, tail, __ATOMIC_RELEASE);
+}
+#endif // ENCODER_INTERRUPT_CAPTURE
 
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
+    queue_overflows = 0;
+#ifdef ENCODER_INTERRUPT_CAPTURE
+    capture_head      = 0;
+    capture_tail      = 0;
+    capture_overflows = 0;
+#endif // ENCODER_INTERRUPT_CAPTURE
     encoder_driver_init();
 }
 
-static void encoder_queue_drain(void) {
-    encoder_events.tail     = encoder_events.head;
-    encoder_events.dequeued = encoder_events.enqueued;
+static void encoder_queue_drain(uint8_t dequeued) {
+    // Events queued after the master read the queue are kept for the next read
+    while (encoder_events.dequeued != dequeued && !encoder_queue_empty()) {
+        encoder_events.tail = (encoder_events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+        encoder_events.dequeued++;
+    }
 }
 
 static bool encoder_handle_queue(void) {
@@ -37,11 +87,13 @@ static bool encoder_handle_queue(void) {
         // The delays below cater for Windows and its wonderful requirements.
         action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
 #    if ENCODER_MAP_KEY_DELAY > 0
+        host_keyboard_flush();
         wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
         action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
 #    if ENCODER_MAP_KEY_DELAY > 0
+        host_keyboard_flush();
         wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
@@ -68,11 +120,14 @@ bool encoder_task(void) {
 
     if (signal_queue_drain) {
         signal_queue_drain = false;
-        encoder_queue_drain();
+        encoder_queue_drain(drain_dequeued);
     }
 
     // Let the encoder driver produce events
     encoder_driver_task();
+#ifdef ENCODER_INTERRUPT_CAPTURE
+    encoder_capture_drain();
+#endif // ENCODER_INTERRUPT_CAPTURE
 
     // Process any events that were enqueued
     if (should_process_encoder()) {
@@ -133,7 +188,11 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
 }
 
 bool encoder_queue_event(uint8_t index, bool clockwise) {
-    return encoder_queue_event_advanced(&encoder_events, index, clockwise);
+    if (!encoder_queue_event_advanced(&encoder_events, index, clockwise)) {
+        queue_overflows++;
+        return false;
+    }
+    return true;
 }
 
 bool encoder_dequeue_event(uint8_t *index, bool *clockwise) {
@@ -144,10 +203,24 @@ void encoder_retrieve_events(encoder_events_t *events) {
     memcpy(events, &encoder_events, sizeof(encoder_events));
 }
 
-void encoder_signal_queue_drain(void) {
+void encoder_signal_queue_drain(uint8_t dequeued) {
+    drain_dequeued     = dequeued;
     signal_queue_drain = true;
 }
 
+uint16_t encoder_dropped_events(void) {
+    uint16_t dropped = queue_overflows;
+#ifdef ENCODER_INTERRUPT_CAPTURE
+    // Read until stable, as the interrupt handler may update it in between the bytes
+    uint16_t overflows;
+    do {
+        overflows = capture_overflows;
+    } while (overflows != capture_overflows);
+    dropped += overflows;
+#endif // ENCODER_INTERRUPT_CAPTURE
+    return dropped;
+}
+
 __attribute__((weak)) bool encoder_update_user(uint8_t index, bool clockwise) {
     return true;
 }
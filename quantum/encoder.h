@@ -45,6 +45,8 @@ void encoder_init(void);
 bool encoder_task(void);
 bool encoder_queue_event(uint8_t index, bool clockwise);
 bool encoder_dequeue_event(uint8_t *index, bool *clockwise);
+bool encoder_queue_full(void);
+bool encoder_queue_empty(void);
 
 bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
@@ -105,9 +107,22 @@ void encoder_retrieve_events(encoder_events_t *events);
 // Encoder event queue management
 bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise);
 bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise);
+bool encoder_queue_empty_advanced(encoder_events_t *events);
 
-// Reset the queue to be empty
-void encoder_signal_queue_drain(void);
+// Remove the events up to the given dequeued count, i.e. the ones already taken by the split master
+void encoder_signal_queue_drain(uint8_t dequeued);
+
+// Number of events lost because a queue was full
+uint16_t encoder_dropped_events(void);
+
+#    ifdef ENCODER_INTERRUPT_CAPTURE
+#        ifndef ENCODER_CAPTURE_QUEUE_SIZE
+#            define ENCODER_CAPTURE_QUEUE_SIZE 16
+#        endif // ENCODER_CAPTURE_QUEUE_SIZE
+
+// Queue an event from an interrupt handler, encoder_task() moves it into the event queue
+bool encoder_capture_event(uint8_t index, bool clockwise);
+#    endif // ENCODER_INTERRUPT_CAPTURE
 
 #    ifdef ENCODER_MAP_ENABLE
 #        define NUM_DIRECTIONS 2
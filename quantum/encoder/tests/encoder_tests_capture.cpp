@@ -0,0 +1,128 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+}
+
+struct update {
+    uint8_t index;
+    bool    clockwise;
+};
+
+std::vector<update> updates;
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates.push_back({index, clockwise});
+    return true;
+}
+
+class EncoderCaptureTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        updates.clear();
+        encoder_init();
+    }
+
+    // Runs the encoder task until it stops producing updates
+    void run_until_idle() {
+        for (int i = 0; i < 100 && encoder_task(); i++) {
+        }
+    }
+};
+
+TEST_F(EncoderCaptureTest, PolledStep_GoesThroughCapture) {
+    setPin(0, false);
+    encoder_task();
+    setPin(1, false);
+    encoder_task();
+    setPin(0, true);
+    encoder_task();
+    setPin(1, true);
+    encoder_task();
+
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_EQ(updates[0].index, 0);
+    EXPECT_TRUE(updates[0].clockwise);
+}
+
+TEST_F(EncoderCaptureTest, CapturedEvents_KeepTheirOrder) {
+    EXPECT_TRUE(encoder_capture_event(0, true));
+    EXPECT_TRUE(encoder_capture_event(0, false));
+    EXPECT_TRUE(encoder_capture_event(0, true));
+    EXPECT_TRUE(updates.empty()) << "Captured events are only handled by the task";
+
+    run_until_idle();
+    ASSERT_EQ(updates.size(), 3);
+    EXPECT_TRUE(updates[0].clockwise);
+    EXPECT_FALSE(updates[1].clockwise);
+    EXPECT_TRUE(updates[2].clockwise);
+}
+
+TEST_F(EncoderCaptureTest, MoreThanTheEventQueue_AllHandled) {
+    // The event queue holds fewer events than the capture queue, the rest wait for the next task
+    for (int i = 0; i < ENCODER_CAPTURE_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(encoder_capture_event(0, i & 1));
+    }
+    run_until_idle();
+    ASSERT_EQ(updates.size(), ENCODER_CAPTURE_QUEUE_SIZE);
+    for (int i = 0; i < ENCODER_CAPTURE_QUEUE_SIZE; i++) {
+        EXPECT_EQ(updates[i].clockwise, (bool)(i & 1)) << "Event " << i;
+    }
+    EXPECT_EQ(encoder_dropped_events(), 0);
+}
+
+TEST_F(EncoderCaptureTest, Overflow_IsCounted) {
+    for (int i = 0; i < ENCODER_CAPTURE_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(encoder_capture_event(0, true));
+    }
+    EXPECT_FALSE(encoder_capture_event(0, true));
+    EXPECT_FALSE(encoder_capture_event(0, false));
+    EXPECT_EQ(encoder_dropped_events(), 2);
+
+    run_until_idle();
+    EXPECT_EQ(updates.size(), ENCODER_CAPTURE_QUEUE_SIZE);
+
+    // Space is available again
+    EXPECT_TRUE(encoder_capture_event(0, false));
+    run_until_idle();
+    EXPECT_EQ(updates.size(), ENCODER_CAPTURE_QUEUE_SIZE + 1);
+    EXPECT_EQ(encoder_dropped_events(), 2);
+}
+
+TEST_F(EncoderCaptureTest, ConcurrentProducer_NothingLostOrReordered) {
+    const int         total = 100000;
+    std::atomic<bool> done{false};
+    int               dropped = 0;
+
+    // Stands in for the interrupt handler, retrying whenever the queue is full
+    std::thread producer([&] {
+        for (int i = 0; i < total; i++) {
+            while (!encoder_capture_event(0, (i % 3) == 0)) {
+                dropped++;
+                std::this_thread::yield();
+            }
+        }
+        done = true;
+    });
+
+    while (!done || updates.size() < (size_t)total) {
+        encoder_task();
+        if (updates.size() > (size_t)total) {
+            break;
+        }
+    }
+    producer.join();
+
+    ASSERT_EQ(updates.size(), (size_t)total);
+    for (int i = 0; i < total; i++) {
+        ASSERT_EQ(updates[i].clockwise, (i % 3) == 0) << "Event " << i;
+    }
+    EXPECT_EQ(encoder_dropped_events(), (uint16_t)dropped);
+}
@@ -190,3 +190,41 @@ TEST_F(EncoderSplitTestLeftEqRight, TestOneClockwiseRightSlave) {
     }
     EXPECT_EQ(events_queued, 1); // One event should be queued on slave
 }
+
+TEST_F(EncoderSplitTestLeftEqRight, TestDrainKeepsEventsAfterRead) {
+    isMaster   = false;
+    isLeftHand = true;
+    encoder_init();
+    setAndRead(0, false);
+    setAndRead(1, false);
+    setAndRead(0, true);
+    setAndRead(1, true);
+
+    // The master reads the queue...
+    encoder_events_t events;
+    encoder_retrieve_events(&events);
+
+    // ...the encoder moves on before the drain arrives...
+    setAndRead(0, false);
+    setAndRead(1, false);
+    setAndRead(0, true);
+    setAndRead(1, true);
+
+    // ...and the master takes what it has read
+    uint8_t index;
+    bool    clockwise;
+    int     events_read = 0;
+    while (encoder_dequeue_event_advanced(&events, &index, &clockwise)) {
+        ++events_read;
+    }
+    EXPECT_EQ(events_read, 1);
+    encoder_signal_queue_drain(events.dequeued);
+    encoder_task();
+
+    int events_queued = 0;
+    encoder_retrieve_events(&events);
+    while (encoder_dequeue_event_advanced(&events, &index, &clockwise)) {
+        ++events_queued;
+    }
+    EXPECT_EQ(events_queued, 1); // The second step is still to be sent
+}
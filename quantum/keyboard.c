@@ -32,6 +32,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "profiler.h"
+#include "task_scheduler.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -104,12 +106,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_NONBLOCKING)
+#    include "send_string.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -468,6 +476,9 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
 #ifdef CONNECTION_ENABLE
     connection_init();
 #endif
@@ -664,20 +675,31 @@ void quantum_task(void) {
     sequencer_task();
 #endif
 
+    // The subsystems below only run when they have asked to be, see task_scheduler.h
+    __attribute__((unused)) const scheduled_tasks_t due = task_scheduler_take_due();
+
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    if (due & SCHEDULED_TASK_BIT(SCHEDULED_TASK_TAP_DANCE)) {
+        tap_dance_task();
+    }
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    if (due & SCHEDULED_TASK_BIT(SCHEDULED_TASK_COMBO)) {
+        combo_task();
+    }
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    if (due & SCHEDULED_TASK_BIT(SCHEDULED_TASK_LEADER)) {
+        leader_task();
+    }
 #endif
 
 #ifdef WPM_ENABLE
-    decay_wpm();
+    if (due & SCHEDULED_TASK_BIT(SCHEDULED_TASK_WPM)) {
+        decay_wpm();
+    }
 #endif
 
 #ifdef DIP_SWITCH_ENABLE
@@ -689,41 +711,61 @@ void quantum_task(void) {
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    if (due & SCHEDULED_TASK_BIT(SCHEDULED_TASK_CAPS_WORD)) {
+        caps_word_task();
+    }
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    if (due & SCHEDULED_TASK_BIT(SCHEDULED_TASK_SECURE)) {
+        secure_task();
+    }
 #endif
 
 #ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
+    if (due & SCHEDULED_TASK_BIT(SCHEDULED_TASK_LAYER_LOCK)) {
+        layer_lock_task();
+    }
+#endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_NONBLOCKING)
+    send_string_task();
 #endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    PROFILER_ZONE_BEGIN("keyboard_task");
+
+    // Merge the keyboard reports of this scan, sent once the key events have been processed
+    host_keyboard_coalesce_begin();
+
+    PROFILER_ZONE_BEGIN("matrix_task");
+    const bool matrix_changed = matrix_task();
+    PROFILER_ZONE_END();
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILER_ZONE_CALL("quantum_task", quantum_task());
+
+    host_keyboard_coalesce_end();
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    PROFILER_ZONE_CALL("rgblight_task", rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    PROFILER_ZONE_CALL("led_matrix_task", led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILER_ZONE_CALL("rgb_matrix_task", rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -733,21 +775,27 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    PROFILER_ZONE_BEGIN("encoder_task");
+    const bool encoder_changed = encoder_task();
+    PROFILER_ZONE_END();
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    PROFILER_ZONE_BEGIN("pointing_device_task");
+    const bool pointing_device_changed = pointing_device_task();
+    PROFILER_ZONE_END();
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    PROFILER_ZONE_CALL("oled_task", oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -796,4 +844,10 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#if defined(EEPROM_WEAR_LEVELING) && defined(WEAR_LEVELING_WRITE_BACK)
+    eeprom_driver_task();
+#endif
+
+    PROFILER_ZONE_END();
 }
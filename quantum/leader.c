@@ -3,6 +3,7 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "task_scheduler.h"
 #include "util.h"
 
 #include <string.h>
@@ -34,6 +35,7 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    task_schedule_in(SCHEDULED_TASK_LEADER, 0);
 }
 
 void leader_end(void) {
@@ -42,9 +44,21 @@ void leader_end(void) {
 }
 
 void leader_task(void) {
-    if (leader_sequence_active() && leader_sequence_timed_out()) {
+    if (!leader_sequence_active()) {
+        return;
+    }
+    if (leader_sequence_timed_out()) {
         leader_end();
+        return;
     }
+
+#if defined(LEADER_NO_TIMEOUT)
+    // The timeout only starts with the first key of the sequence
+    if (leader_sequence_size == 0) {
+        return;
+    }
+#endif
+    task_schedule_in(SCHEDULED_TASK_LEADER, LEADER_TIMEOUT - timer_elapsed(leader_time) + 1);
 }
 
 bool leader_sequence_active(void) {
@@ -64,6 +78,7 @@ bool leader_sequence_add(uint16_t keycode) {
 
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
+    task_schedule_in(SCHEDULED_TASK_LEADER, 0);
 
     if (leader_add_user(keycode)) {
         leader_end();
@@ -81,6 +96,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    task_schedule_in(SCHEDULED_TASK_LEADER, 0);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
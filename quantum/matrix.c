@@ -266,6 +266,101 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_EDGE_WAKEUP
+#    if defined(DIRECT_PINS) || !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#        error MATRIX_EDGE_WAKEUP requires a row/column matrix with MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    endif
+
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define WAKEUP_OUTPUTS row_pins
+#        define WAKEUP_OUTPUT_COUNT MATRIX_ROWS_PER_HAND
+#        define WAKEUP_INPUTS col_pins
+#        define WAKEUP_INPUT_COUNT MATRIX_COLS
+#        define WAKEUP_UNSELECT_OUTPUTS() unselect_rows()
+#    else
+#        define WAKEUP_OUTPUTS col_pins
+#        define WAKEUP_OUTPUT_COUNT MATRIX_COLS
+#        define WAKEUP_INPUTS row_pins
+#        define WAKEUP_INPUT_COUNT MATRIX_ROWS_PER_HAND
+#        define WAKEUP_UNSELECT_OUTPUTS() unselect_cols()
+#    endif
+
+// While parked every output is selected, so any pressed key pulls its input low.
+static bool matrix_parked = false;
+
+// Platform hooks, by default the inputs are polled on every scan.
+__attribute__((weak)) void matrix_wakeup_enable(pin_t pin) {}
+__attribute__((weak)) void matrix_wakeup_disable(pin_t pin) {}
+__attribute__((weak)) bool matrix_wakeup_pending(void) {
+    return true;
+}
+
+static bool matrix_parked_input_active(void) {
+    for (uint8_t i = 0; i < WAKEUP_INPUT_COUNT; i++) {
+        if (WAKEUP_INPUTS[i] != NO_PIN && readMatrixPin(WAKEUP_INPUTS[i]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void matrix_unpark(void) {
+    for (uint8_t i = 0; i < WAKEUP_INPUT_COUNT; i++) {
+        if (WAKEUP_INPUTS[i] != NO_PIN) {
+            matrix_wakeup_disable(WAKEUP_INPUTS[i]);
+        }
+    }
+    WAKEUP_UNSELECT_OUTPUTS();
+    matrix_output_unselect_delay(0, true);
+    matrix_parked = false;
+}
+
+static void matrix_park(void) {
+    for (uint8_t i = 0; i < WAKEUP_OUTPUT_COUNT; i++) {
+        if (WAKEUP_OUTPUTS[i] != NO_PIN) {
+            gpio_atomic_set_pin_output_low(WAKEUP_OUTPUTS[i]);
+        }
+    }
+    matrix_output_select_delay();
+    for (uint8_t i = 0; i < WAKEUP_INPUT_COUNT; i++) {
+        if (WAKEUP_INPUTS[i] != NO_PIN) {
+            matrix_wakeup_enable(WAKEUP_INPUTS[i]);
+        }
+    }
+    // Drop edges caused by parking itself, then catch presses that happened
+    // before the edge detection was armed.
+    matrix_wakeup_pending();
+    matrix_parked = true;
+    if (matrix_parked_input_active()) {
+        matrix_unpark();
+    }
+}
+
+/**
+ * @brief Returns true if a full scan is required, unparking the matrix if
+ * an input became active.
+ */
+static bool matrix_wakeup(void) {
+    if (!matrix_parked) {
+        return true;
+    }
+    if (!matrix_wakeup_pending() || !matrix_parked_input_active()) {
+        return false;
+    }
+    matrix_unpark();
+    return true;
+}
+
+static bool matrix_raw_is_idle(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        if (raw_matrix[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif // MATRIX_EDGE_WAKEUP
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -298,6 +393,9 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#ifdef MATRIX_EDGE_WAKEUP
+    matrix_parked = false;
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -316,7 +414,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
+static bool matrix_scan_raw(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
@@ -334,6 +432,23 @@ uint8_t matrix_scan(void) {
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+    return changed;
+}
+
+uint8_t matrix_scan(void) {
+#ifdef MATRIX_EDGE_WAKEUP
+    // Only scan the whole matrix while keys are down, otherwise wait for an
+    // input edge with all outputs selected.
+    bool changed = false;
+    if (matrix_wakeup()) {
+        changed = matrix_scan_raw();
+        if (matrix_raw_is_idle()) {
+            matrix_park();
+        }
+    }
+#else
+    bool changed = matrix_scan_raw();
+#endif
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed) | matrix_post_scan();
@@ -71,6 +71,14 @@ void matrix_output_unselect_delay(uint8_t line, bool key_pressed);
 /* only for backwards compatibility. delay between changing matrix pin state and reading values */
 void matrix_io_delay(void);
 
+#ifdef MATRIX_EDGE_WAKEUP
+/* arm/disarm edge detection on an input pin while the matrix is parked */
+void matrix_wakeup_enable(pin_t pin);
+void matrix_wakeup_disable(pin_t pin);
+/* whether an edge was detected since the last call, clears the flag */
+bool matrix_wakeup_pending(void);
+#endif
+
 /* power control */
 void matrix_power_up(void);
 void matrix_power_down(void);
@@ -1,8 +1,10 @@
 // Copyright 2024 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "compiler_support.h"
 #include "keycodes.h"
+#include "util.h"
 #include "eeprom.h"
 #include "dynamic_keymap.h"
 #include "nvm_dynamic_keymap.h"
@@ -68,6 +70,16 @@ STATIC_ASSERT((int64_t)(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (int64_t)(DYNAMIC_KEYM
 #    define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR - DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + 1)
 #endif
 
+// Bulk updates are split at multiples of this, which is also the size of the compare buffer on the stack.
+// Matches the page size of external EEPROMs, so that no write crosses a page.
+#ifndef DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE
+#    ifdef EXTERNAL_EEPROM_PAGE_SIZE
+#        define DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE EXTERNAL_EEPROM_PAGE_SIZE
+#    else
+#        define DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE 32
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void nvm_dynamic_keymap_erase(void) {
@@ -122,73 +134,69 @@ void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool c
 }
 #endif // ENCODER_MAP_ENABLE
 
-void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint32_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+// Reads the part of the requested range that lies within the region in one go, and zeroes the rest
+static void read_region(uint32_t region_address, uint32_t region_size, uint32_t offset, uint32_t size, uint8_t *data) {
+    uint32_t stored = offset < region_size ? MIN(size, region_size - offset) : 0;
+    if (stored > 0) {
+        eeprom_read_block(data, (void *)(uintptr_t)(region_address + offset), stored);
     }
+    memset(data + stored, 0x00, size - stored);
 }
 
-void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint32_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
+// Updates the part of the requested range that lies within the region, one page at a time. Each page is
+// compared with what is stored, and only the bytes from the first to the last difference are written.
+static void update_region(uint32_t region_address, uint32_t region_size, uint32_t offset, uint32_t size, const uint8_t *data) {
+    uint8_t  stored[DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE];
+    uint32_t remaining = offset < region_size ? MIN(size, region_size - offset) : 0;
+    uint32_t address   = region_address + offset;
+    while (remaining > 0) {
+        uint32_t chunk = MIN(remaining, DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE - (address % DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE));
+        eeprom_read_block(stored, (void *)(uintptr_t)address, chunk);
+
+        uint32_t first = 0;
+        uint32_t last  = chunk;
+        while (first < chunk && stored[first] == data[first]) {
+            first++;
         }
-        source++;
-        target++;
+        while (last > first && stored[last - 1] == data[last - 1]) {
+            last--;
+        }
+        if (first < last) {
+            eeprom_write_block(data + first, (void *)(uintptr_t)(address + first), last - first);
+        }
+
+        address += chunk;
+        data += chunk;
+        remaining -= chunk;
     }
 }
 
+void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
+    read_region(DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2, offset, size, data);
+}
+
+void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
+    update_region(DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2, offset, size, data);
+}
+
 uint32_t nvm_dynamic_keymap_macro_size(void) {
     return DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE;
 }
 
 void nvm_dynamic_keymap_macro_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    read_region(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE, offset, size, data);
 }
 
 void nvm_dynamic_keymap_macro_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    update_region(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE, offset, size, data);
 }
 
 void nvm_dynamic_keymap_macro_reset(void) {
-    void *  start     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *  end       = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    long    remaining = end - start;
-    uint8_t dummy[16] = {0};
-    for (int i = 0; i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; i += sizeof(dummy)) {
-        int this_loop = remaining < sizeof(dummy) ? remaining : sizeof(dummy);
-        eeprom_update_block(dummy, start, this_loop);
-        start += this_loop;
-        remaining -= this_loop;
+    static const uint8_t zeroes[DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE] = {0};
+    uint32_t             offset                                  = 0;
+    while (offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+        uint32_t chunk = DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE - ((DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset) % DYNAMIC_KEYMAP_EEPROM_PAGE_SIZE);
+        update_region(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE, offset, chunk, zeroes);
+        offset += chunk;
     }
 }
@@ -97,6 +97,11 @@ bool qp_clear(painter_device_t device) {
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Keep the order with respect to queued drawing commands
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_clear: fail (could not start comms)\n");
         return false;
@@ -112,6 +117,15 @@ bool qp_clear(painter_device_t device) {
 // Quantum Painter External API: qp_flush
 
 bool qp_flush(painter_device_t device) {
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Draw any queued drawing commands first, so that they are part of what is flushed
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
+    return qp_internal_flush(device);
+}
+
+bool qp_internal_flush(painter_device_t device) {
     qp_dprintf("qp_flush: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -285,6 +299,11 @@ bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Keep the order with respect to queued drawing commands
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_viewport: fail (could not start comms)\n");
         return false;
@@ -308,6 +327,11 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Keep the order with respect to queued drawing commands
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_pixdata: fail (could not start comms)\n");
         return false;
@@ -88,6 +88,22 @@
 #    define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_DEFERRED_ARENA_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) used to hold drawing commands while deferred drawing is enabled, see
+ *      \ref qp_set_deferred_draw. Once it is full, the queued commands are drawn before any further ones are queued.
+ */
+#    define QUANTUM_PAINTER_DEFERRED_ARENA_SIZE 512
+#endif // QUANTUM_PAINTER_DEFERRED_ARENA_SIZE
+
+#ifndef QUANTUM_PAINTER_DEFERRED_DRAW_BUDGET_MS
+/**
+ * @def This controls the amount of time (in milliseconds) that each execution of the Quantum Painter internal task may
+ *      spend drawing deferred commands. At least one step is drawn per execution, regardless of this value.
+ */
+#    define QUANTUM_PAINTER_DEFERRED_DRAW_BUDGET_MS 1
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_BUDGET_MS
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
@@ -488,6 +504,43 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: deferred drawing
+
+/**
+ * Enables or disables deferred drawing.
+ *
+ * While enabled, \ref qp_setpixel, \ref qp_line, \ref qp_rect, \ref qp_circle, \ref qp_ellipse, \ref qp_drawimage and
+ * \ref qp_drawtext (and their recolor variants) queue the drawing command and return immediately. The queue is drawn
+ * in order by the Quantum Painter internal task, spending at most \ref QUANTUM_PAINTER_DEFERRED_DRAW_BUDGET_MS per
+ * execution. Queued commands which are completely covered by a later filled rectangle are discarded.
+ *
+ * @note Images and fonts must stay loaded until the commands using them have been drawn. Closing them, or using
+ *       \ref qp_clear, \ref qp_flush, \ref qp_viewport or \ref qp_pixdata, draws the queue first.
+ *
+ * @param deferred[in] whether or not drawing should be deferred; disabling draws the queue straight away
+ */
+void qp_set_deferred_draw(bool deferred);
+
+/**
+ * Retrieves whether deferred drawing is enabled.
+ */
+bool qp_get_deferred_draw(void);
+
+/**
+ * Retrieves whether there are deferred drawing commands that have not been drawn yet.
+ */
+bool qp_deferred_draw_pending(void);
+
+/**
+ * Draws all queued drawing commands straight away.
+ */
+void qp_deferred_draw_sync(void);
+
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -98,3 +98,24 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter deferred drawing
+
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
+// Whether drawing commands should be queued -- false while the queue itself is being drawn
+bool qp_internal_deferred_draw_active(void);
+
+// Queue the equivalent drawing commands, arguments are expected to be validated already
+bool    qp_internal_defer_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+bool    qp_internal_defer_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
+bool    qp_internal_defer_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+bool    qp_internal_defer_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+bool    qp_internal_defer_drawimage(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+int16_t qp_internal_defer_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char* str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+// Draws queued commands within the time budget, invoked from qp_internal_task
+void qp_internal_deferred_draw_task(void);
+
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
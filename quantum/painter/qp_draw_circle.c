@@ -133,6 +133,12 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    if (qp_internal_deferred_draw_active()) {
+        return qp_internal_defer_circle(device, x, y, radius, hue, sat, val, filled);
+    }
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     // plot the initial set of points for x, y and r
     int16_t xcalc = 0;
     int16_t ycalc = (int16_t)radius;
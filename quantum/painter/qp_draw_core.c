@@ -151,6 +151,12 @@ bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, u
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    if (qp_internal_deferred_draw_active()) {
+        return qp_internal_defer_rect(device, x, y, x, y, hue, sat, val, true);
+    }
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("Failed to start comms in qp_setpixel\n");
         return false;
@@ -181,6 +187,12 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    if (qp_internal_deferred_draw_active()) {
+        return qp_internal_defer_line(device, x0, y0, x1, y1, hue, sat, val);
+    }
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("Failed to start comms in qp_line\n");
         return false;
@@ -267,6 +279,12 @@ bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t righ
     uint16_t w = r - l + 1;
     uint16_t h = b - t + 1;
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    if (qp_internal_deferred_draw_active()) {
+        return qp_internal_defer_rect(device, l, t, r, b, hue, sat, val, filled);
+    }
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     bool ret = true;
     if (!qp_comms_start(device)) {
         qp_dprintf("Failed to start comms in qp_rect\n");
@@ -0,0 +1,348 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "compiler_support.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Command queue
+//
+// Commands are appended to a byte arena and executed in order by the Quantum Painter task. The arena is reset once all
+// commands have been executed, and drained synchronously if a command does not fit in the remaining space.
+
+enum {
+    QP_DEFERRED_NONE, // executed or superseded by a later command
+    QP_DEFERRED_RECT,
+    QP_DEFERRED_LINE,
+    QP_DEFERRED_CIRCLE,
+    QP_DEFERRED_ELLIPSE,
+    QP_DEFERRED_IMAGE,
+    QP_DEFERRED_TEXT,
+};
+
+typedef struct qp_deferred_cmd_t {
+    uint16_t         size; // of the whole record, including any trailing text
+    uint8_t          type;
+    painter_device_t device;
+
+    // Area drawn by the command, used to discard commands which are completely drawn over
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+
+    union {
+        struct {
+            uint8_t  hue, sat, val;
+            bool     filled;
+            uint16_t rows_done; // filled rectangles are drawn a few rows at a time
+        } rect;
+        struct {
+            uint16_t x0, y0, x1, y1;
+            uint8_t  hue, sat, val;
+        } line;
+        struct {
+            uint16_t x, y, sizex, sizey; // sizex is the radius for circles
+            uint8_t  hue, sat, val;
+            bool     filled;
+        } shape;
+        struct {
+            union {
+                painter_image_handle_t image;
+                painter_font_handle_t  font; // the NUL-terminated text follows the record
+            };
+            uint16_t x, y;
+            uint8_t  hue_fg, sat_fg, val_fg;
+            uint8_t  hue_bg, sat_bg, val_bg;
+        } asset;
+    };
+} qp_deferred_cmd_t;
+
+#    define QP_DEFERRED_RECORD_SIZE(extra) (((sizeof(qp_deferred_cmd_t) + (extra)) + 3) & ~3)
+#    define QP_DEFERRED_NO_COMMAND UINT16_MAX
+
+STATIC_ASSERT((QUANTUM_PAINTER_DEFERRED_ARENA_SIZE) >= QP_DEFERRED_RECORD_SIZE(0) && (QUANTUM_PAINTER_DEFERRED_ARENA_SIZE) < QP_DEFERRED_NO_COMMAND, "QUANTUM_PAINTER_DEFERRED_ARENA_SIZE must fit at least one command, and be less than 65535");
+
+__attribute__((__aligned__(4))) static uint8_t deferred_arena[QUANTUM_PAINTER_DEFERRED_ARENA_SIZE];
+static uint16_t                                deferred_head = 0;
+static uint16_t                                deferred_tail = 0;
+static uint16_t                                deferred_last = QP_DEFERRED_NO_COMMAND;
+static bool                                    deferred_enabled   = false;
+static bool                                    deferred_executing = false;
+
+static inline qp_deferred_cmd_t *qp_deferred_cmd_at(uint16_t offset) {
+    return (qp_deferred_cmd_t *)&deferred_arena[offset];
+}
+
+static inline uint16_t qp_deferred_clamp(int32_t v) {
+    return (uint16_t)QP_MAX(0, QP_MIN(v, UINT16_MAX));
+}
+
+static bool qp_deferred_execute(qp_deferred_cmd_t *cmd) {
+    bool ret = true;
+    switch (cmd->type) {
+        case QP_DEFERRED_RECT:
+            if (!cmd->rect.filled) {
+                ret = qp_rect(cmd->device, cmd->left, cmd->top, cmd->right, cmd->bottom, cmd->rect.hue, cmd->rect.sat, cmd->rect.val, false);
+                break;
+            }
+            {
+                // Draw as many rows as fit in the pixdata buffer, the remainder is drawn on the next step
+                uint16_t width = cmd->right - cmd->left + 1;
+                uint16_t rows  = QP_MAX(1, QP_MIN(qp_internal_num_pixels_in_buffer(cmd->device) / width, UINT16_MAX));
+                uint16_t top   = cmd->top + cmd->rect.rows_done;
+                uint16_t bot   = QP_MIN((uint32_t)top + rows - 1, cmd->bottom);
+                ret            = qp_rect(cmd->device, cmd->left, top, cmd->right, bot, cmd->rect.hue, cmd->rect.sat, cmd->rect.val, true);
+                if (ret && bot < cmd->bottom) {
+                    cmd->rect.rows_done += rows;
+                    return false;
+                }
+            }
+            break;
+        case QP_DEFERRED_LINE:
+            ret = qp_line(cmd->device, cmd->line.x0, cmd->line.y0, cmd->line.x1, cmd->line.y1, cmd->line.hue, cmd->line.sat, cmd->line.val);
+            break;
+        case QP_DEFERRED_CIRCLE:
+            ret = qp_circle(cmd->device, cmd->shape.x, cmd->shape.y, cmd->shape.sizex, cmd->shape.hue, cmd->shape.sat, cmd->shape.val, cmd->shape.filled);
+            break;
+        case QP_DEFERRED_ELLIPSE:
+            ret = qp_ellipse(cmd->device, cmd->shape.x, cmd->shape.y, cmd->shape.sizex, cmd->shape.sizey, cmd->shape.hue, cmd->shape.sat, cmd->shape.val, cmd->shape.filled);
+            break;
+        case QP_DEFERRED_IMAGE:
+            ret = qp_drawimage_recolor(cmd->device, cmd->asset.x, cmd->asset.y, cmd->asset.image, cmd->asset.hue_fg, cmd->asset.sat_fg, cmd->asset.val_fg, cmd->asset.hue_bg, cmd->asset.sat_bg, cmd->asset.val_bg);
+            break;
+        case QP_DEFERRED_TEXT:
+            ret = qp_drawtext_recolor(cmd->device, cmd->asset.x, cmd->asset.y, cmd->asset.font, (const char *)(cmd + 1), cmd->asset.hue_fg, cmd->asset.sat_fg, cmd->asset.val_fg, cmd->asset.hue_bg, cmd->asset.sat_bg, cmd->asset.val_bg) != 0;
+            break;
+    }
+
+    if (!ret) {
+        qp_dprintf("qp_deferred_execute: fail (command type %d dropped)\n", (int)cmd->type);
+    }
+    return true;
+}
+
+// Executes (part of) the oldest command, returns false if the queue is empty
+static bool qp_deferred_step(void) {
+    while (deferred_head < deferred_tail && qp_deferred_cmd_at(deferred_head)->type == QP_DEFERRED_NONE) {
+        deferred_head += qp_deferred_cmd_at(deferred_head)->size;
+    }
+
+    if (deferred_head >= deferred_tail) {
+        deferred_head = 0;
+        deferred_tail = 0;
+        deferred_last = QP_DEFERRED_NO_COMMAND;
+        return false;
+    }
+
+    qp_deferred_cmd_t *cmd = qp_deferred_cmd_at(deferred_head);
+    deferred_executing     = true;
+    bool done              = qp_deferred_execute(cmd);
+    deferred_executing     = false;
+    if (done) {
+        cmd->type = QP_DEFERRED_NONE;
+        deferred_head += cmd->size;
+    }
+    return true;
+}
+
+// Allocates a command, or returns NULL if it can never fit in the arena -- only possible for text
+static qp_deferred_cmd_t *qp_deferred_alloc(painter_device_t device, uint8_t type, size_t extra, int32_t left, int32_t top, int32_t right, int32_t bottom) {
+    size_t size = QP_DEFERRED_RECORD_SIZE(extra);
+    if (size > sizeof(deferred_arena)) {
+        return NULL;
+    }
+
+    if (deferred_tail + size > sizeof(deferred_arena)) {
+        qp_dprintf("qp_deferred_alloc: arena full, draining\n");
+        qp_deferred_draw_sync();
+    }
+
+    qp_deferred_cmd_t *cmd = qp_deferred_cmd_at(deferred_tail);
+    memset(cmd, 0, sizeof(qp_deferred_cmd_t));
+    cmd->size   = size;
+    cmd->type   = type;
+    cmd->device = device;
+    cmd->left   = qp_deferred_clamp(left);
+    cmd->top    = qp_deferred_clamp(top);
+    cmd->right  = qp_deferred_clamp(right);
+    cmd->bottom = qp_deferred_clamp(bottom);
+
+    deferred_last = deferred_tail;
+    deferred_tail += size;
+    return cmd;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Core API: deferred drawing
+
+bool qp_internal_deferred_draw_active(void) {
+    return deferred_enabled && !deferred_executing;
+}
+
+bool qp_internal_defer_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    if (filled) {
+        // Discard queued commands which this rectangle draws over completely
+        for (uint16_t offset = deferred_head; offset < deferred_tail; offset += qp_deferred_cmd_at(offset)->size) {
+            qp_deferred_cmd_t *cmd = qp_deferred_cmd_at(offset);
+            if (cmd->type != QP_DEFERRED_NONE && cmd->device == device && cmd->left >= left && cmd->right <= right && cmd->top >= top && cmd->bottom <= bottom) {
+                cmd->type = QP_DEFERRED_NONE;
+            }
+        }
+
+        // Extend the previous rectangle if it has the same color, and both make up a larger rectangle
+        if (deferred_last != QP_DEFERRED_NO_COMMAND) {
+            qp_deferred_cmd_t *last = qp_deferred_cmd_at(deferred_last);
+            if (last->type == QP_DEFERRED_RECT && last->rect.filled && last->rect.rows_done == 0 && last->device == device && last->rect.hue == hue && last->rect.sat == sat && last->rect.val == val) {
+                bool same_columns = last->left == left && last->right == right && top <= last->bottom + 1 && bottom + 1 >= last->top;
+                bool same_rows    = last->top == top && last->bottom == bottom && left <= last->right + 1 && right + 1 >= last->left;
+                if (same_columns || same_rows) {
+                    last->left   = QP_MIN(last->left, left);
+                    last->top    = QP_MIN(last->top, top);
+                    last->right  = QP_MAX(last->right, right);
+                    last->bottom = QP_MAX(last->bottom, bottom);
+                    return true;
+                }
+            }
+        }
+    }
+
+    qp_deferred_cmd_t *cmd = qp_deferred_alloc(device, QP_DEFERRED_RECT, 0, left, top, right, bottom);
+    cmd->rect.hue          = hue;
+    cmd->rect.sat          = sat;
+    cmd->rect.val          = val;
+    cmd->rect.filled       = filled;
+    return true;
+}
+
+bool qp_internal_defer_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val) {
+    qp_deferred_cmd_t *cmd = qp_deferred_alloc(device, QP_DEFERRED_LINE, 0, QP_MIN(x0, x1), QP_MIN(y0, y1), QP_MAX(x0, x1), QP_MAX(y0, y1));
+    cmd->line.x0           = x0;
+    cmd->line.y0           = y0;
+    cmd->line.x1           = x1;
+    cmd->line.y1           = y1;
+    cmd->line.hue          = hue;
+    cmd->line.sat          = sat;
+    cmd->line.val          = val;
+    return true;
+}
+
+bool qp_internal_defer_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_deferred_cmd_t *cmd = qp_deferred_alloc(device, QP_DEFERRED_CIRCLE, 0, (int32_t)x - radius, (int32_t)y - radius, (int32_t)x + radius, (int32_t)y + radius);
+    cmd->shape.x           = x;
+    cmd->shape.y           = y;
+    cmd->shape.sizex       = radius;
+    cmd->shape.hue         = hue;
+    cmd->shape.sat         = sat;
+    cmd->shape.val         = val;
+    cmd->shape.filled      = filled;
+    return true;
+}
+
+bool qp_internal_defer_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_deferred_cmd_t *cmd = qp_deferred_alloc(device, QP_DEFERRED_ELLIPSE, 0, (int32_t)x - sizex, (int32_t)y - sizey, (int32_t)x + sizex, (int32_t)y + sizey);
+    cmd->shape.x           = x;
+    cmd->shape.y           = y;
+    cmd->shape.sizex       = sizex;
+    cmd->shape.sizey       = sizey;
+    cmd->shape.hue         = hue;
+    cmd->shape.sat         = sat;
+    cmd->shape.val         = val;
+    cmd->shape.filled      = filled;
+    return true;
+}
+
+bool qp_internal_defer_drawimage(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_deferred_cmd_t *cmd = qp_deferred_alloc(device, QP_DEFERRED_IMAGE, 0, x, y, (int32_t)x + image->width - 1, (int32_t)y + image->height - 1);
+    cmd->asset.image       = image;
+    cmd->asset.x           = x;
+    cmd->asset.y           = y;
+    cmd->asset.hue_fg      = hue_fg;
+    cmd->asset.sat_fg      = sat_fg;
+    cmd->asset.val_fg      = val_fg;
+    cmd->asset.hue_bg      = hue_bg;
+    cmd->asset.sat_bg      = sat_bg;
+    cmd->asset.val_bg      = val_bg;
+    return true;
+}
+
+int16_t qp_internal_defer_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    int16_t width = qp_textwidth(font, str);
+    if (width <= 0) {
+        return width;
+    }
+
+    size_t             length = strlen(str) + 1;
+    qp_deferred_cmd_t *cmd    = qp_deferred_alloc(device, QP_DEFERRED_TEXT, length, x, y, (int32_t)x + width - 1, (int32_t)y + font->line_height - 1);
+    qp_deferred_cmd_t  direct = {0};
+    if (!cmd) {
+        cmd = &direct;
+    }
+
+    cmd->asset.font   = font;
+    cmd->asset.x      = x;
+    cmd->asset.y      = y;
+    cmd->asset.hue_fg = hue_fg;
+    cmd->asset.sat_fg = sat_fg;
+    cmd->asset.val_fg = val_fg;
+    cmd->asset.hue_bg = hue_bg;
+    cmd->asset.sat_bg = sat_bg;
+    cmd->asset.val_bg = val_bg;
+
+    if (cmd == &direct) {
+        // Too long for the arena, draw it straight away
+        qp_deferred_draw_sync();
+        deferred_executing = true;
+        width              = qp_drawtext_recolor(device, x, y, font, str, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+        deferred_executing = false;
+        return width;
+    }
+
+    memcpy(cmd + 1, str, length);
+    return width;
+}
+
+void qp_internal_deferred_draw_task(void) {
+    uint32_t start = timer_read32();
+    while (qp_deferred_step() && TIMER_DIFF_32(timer_read32(), start) < (QUANTUM_PAINTER_DEFERRED_DRAW_BUDGET_MS)) {
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: deferred drawing
+
+void qp_set_deferred_draw(bool deferred) {
+    if (!deferred) {
+        qp_deferred_draw_sync();
+    }
+    deferred_enabled = deferred;
+}
+
+bool qp_get_deferred_draw(void) {
+    return deferred_enabled;
+}
+
+bool qp_deferred_draw_pending(void) {
+    for (uint16_t offset = deferred_head; offset < deferred_tail; offset += qp_deferred_cmd_at(offset)->size) {
+        if (qp_deferred_cmd_at(offset)->type != QP_DEFERRED_NONE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void qp_deferred_draw_sync(void) {
+    // Commands being executed may end up here, e.g. via qp_viewport -- they are already in order
+    if (deferred_executing) {
+        return;
+    }
+
+    while (qp_deferred_step()) {
+    }
+}
+
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
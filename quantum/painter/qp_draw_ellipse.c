@@ -67,6 +67,12 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    if (qp_internal_deferred_draw_active()) {
+        return qp_internal_defer_ellipse(device, x, y, sizex, sizey, hue, sat, val, filled);
+    }
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     int32_t aa = ((int32_t)sizex) * ((int32_t)sizex);
     int32_t bb = ((int32_t)sizey) * ((int32_t)sizey);
     int32_t fa = 4 * aa;
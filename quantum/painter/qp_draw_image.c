@@ -95,6 +95,11 @@ bool qp_close_image(painter_image_handle_t image) {
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Queued commands may still refer to the image
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
@@ -275,6 +280,17 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    if (qp_internal_deferred_draw_active()) {
+        painter_driver_t   *driver    = (painter_driver_t *)device;
+        qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+        if (!driver || !driver->validate_ok || !qgf_image || !qgf_image->validate_ok) {
+            qp_dprintf("qp_drawimage_recolor: fail (invalid driver or image)\n");
+            return false;
+        }
+        return qp_internal_defer_drawimage(device, x, y, image, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+    }
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
     return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
 }
 
@@ -305,6 +321,10 @@ static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATION
 static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Animations are drawn straight away, anything queued before has to be drawn first
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
     bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
     if (ret) {
         ++state->frame_number;
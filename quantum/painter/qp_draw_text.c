@@ -142,6 +142,11 @@ bool qp_close_font(painter_font_handle_t font) {
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Queued commands may still refer to the font
+    qp_deferred_draw_sync();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     // Nuke the buffer, if required
     if (qff_font->owns_buffer) {
@@ -411,6 +416,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    if (qp_internal_deferred_draw_active()) {
+        return qp_internal_defer_drawtext(device, x, y, font, str, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+    }
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
         return 0;
@@ -84,6 +84,12 @@ void qp_internal_task(void) {
     qp_internal_display_timeout_task();
 #endif // (QUANTUM_PAINTER_DISPLAY_TIMEOUT) > 0
 
+#ifdef QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    // Draw queued commands, before animations draw over them
+    void qp_internal_deferred_draw_task(void);
+    qp_internal_deferred_draw_task();
+#endif // QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+
     // Handle animations
     void qp_internal_animation_tick(void);
     qp_internal_animation_tick();
@@ -99,9 +105,10 @@ void qp_internal_task(void) {
     bool old_debug_state = debug_enable;
     debug_enable         = false;
 #endif // defined(QUANTUM_PAINTER_DEBUG_ENABLE_FLUSH_TASK_OUTPUT)
+    // Commands still queued once the time budget ran out are drawn and flushed on a later execution
     for (uint8_t i = 0; i < QP_NUM_DEVICES; i++) {
         if (qp_devices[i] != NULL) {
-            qp_flush(qp_devices[i]);
+            qp_internal_flush(qp_devices[i]);
         }
     }
 #if !defined(QUANTUM_PAINTER_DEBUG_ENABLE_FLUSH_TASK_OUTPUT)
@@ -31,3 +31,9 @@
 
 #include <qp_internal_formats.h>
 #include <qp_internal_driver.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Core API: flushing
+
+// qp_flush without drawing queued deferred commands first, for flushes made while the queue is being drawn or flushed
+bool qp_internal_flush(painter_device_t device);
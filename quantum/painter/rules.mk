@@ -1,6 +1,7 @@
 # Quantum Painter Configurables
 QUANTUM_PAINTER_DRIVERS ?=
 QUANTUM_PAINTER_ANIMATIONS_ENABLE ?= yes
+QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE ?= no
 
 QUANTUM_PAINTER_LVGL_INTEGRATION ?= no
 
@@ -49,6 +50,12 @@ ifeq ($(strip $(QUANTUM_PAINTER_ANIMATIONS_ENABLE)), yes)
     OPT_DEFS += -DQUANTUM_PAINTER_ANIMATIONS_ENABLE
 endif
 
+# Queue drawing commands and draw them from the Quantum Painter task
+ifeq ($(strip $(QUANTUM_PAINTER_DEFERRED_DRAW_ENABLE)), yes)
+    OPT_DEFS += -DQUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_draw_deferred.c
+endif
+
 # Comms flags
 QUANTUM_PAINTER_NEEDS_COMMS_DUMMY ?= no
 QUANTUM_PAINTER_NEEDS_COMMS_SPI ?= no
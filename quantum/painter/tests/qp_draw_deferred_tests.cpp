@@ -0,0 +1,238 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp_draw.h"
+}
+
+// The drawing commands as the queue finally issues them
+struct Drawn {
+    std::string      what;
+    painter_device_t device;
+    int              left, top, right, bottom;
+
+    bool operator==(const Drawn &other) const {
+        return what == other.what && device == other.device && left == other.left && top == other.top && right == other.right && bottom == other.bottom;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const Drawn &drawn) {
+    return os << drawn.what << "(" << drawn.left << "," << drawn.top << "," << drawn.right << "," << drawn.bottom << ")";
+}
+
+static std::vector<Drawn> drawn;
+static uint32_t           pixels_in_buffer;
+static uint32_t           now;
+
+extern "C" {
+
+bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    drawn.push_back({filled ? "fill" : "rect", device, left, top, right, bottom});
+    return true;
+}
+
+bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val) {
+    drawn.push_back({"line", device, x0, y0, x1, y1});
+    return true;
+}
+
+bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    drawn.push_back({"circle", device, x, y, radius, radius});
+    return true;
+}
+
+bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    drawn.push_back({"ellipse", device, x, y, sizex, sizey});
+    return true;
+}
+
+bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    drawn.push_back({"image", device, x, y, x + image->width - 1, y + image->height - 1});
+    return true;
+}
+
+int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
+    return (int16_t)(strlen(str) * 6);
+}
+
+int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    drawn.push_back({std::string("text ") + str, device, x, y, x + qp_textwidth(font, str) - 1, y + font->line_height - 1});
+    return qp_textwidth(font, str);
+}
+
+uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
+    return pixels_in_buffer;
+}
+
+// Every reading of the clock moves it on by a millisecond, so the task only gets through one step per execution
+uint32_t timer_read32(void) {
+    return now++;
+}
+}
+
+static const int                 displays[2] = {};
+static const painter_device_t    display     = &displays[0];
+static const painter_device_t    other       = &displays[1];
+static const painter_font_desc_t font        = {8};
+
+class QpDrawDeferred : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        qp_set_deferred_draw(false);
+        drawn.clear();
+        pixels_in_buffer = 1024;
+        qp_set_deferred_draw(true);
+    }
+
+    void TearDown() override {
+        qp_set_deferred_draw(false);
+    }
+};
+
+TEST_F(QpDrawDeferred, Queued_DrawnInOrderBySync) {
+    qp_internal_defer_line(display, 0, 0, 9, 0, 0, 0, 255);
+    qp_internal_defer_rect(display, 0, 2, 9, 4, 0, 0, 255, false);
+    qp_internal_defer_circle(display, 20, 20, 5, 0, 0, 255, true);
+    EXPECT_TRUE(drawn.empty());
+    EXPECT_TRUE(qp_deferred_draw_pending());
+
+    qp_deferred_draw_sync();
+    std::vector<Drawn> expected = {{"line", display, 0, 0, 9, 0}, {"rect", display, 0, 2, 9, 4}, {"circle", display, 20, 20, 5, 5}};
+    EXPECT_EQ(drawn, expected);
+    EXPECT_FALSE(qp_deferred_draw_pending());
+}
+
+TEST_F(QpDrawDeferred, Task_DrawsOneStepPerExecution) {
+    qp_internal_defer_line(display, 0, 0, 9, 0, 0, 0, 255);
+    qp_internal_defer_line(display, 0, 1, 9, 1, 0, 0, 255);
+
+    qp_internal_deferred_draw_task();
+    EXPECT_EQ(drawn.size(), 1u);
+    qp_internal_deferred_draw_task();
+    EXPECT_EQ(drawn.size(), 2u);
+    EXPECT_FALSE(qp_deferred_draw_pending());
+}
+
+TEST_F(QpDrawDeferred, LargeFill_DrawnAFewRowsAtATime) {
+    // 20 pixels wide, with room for 5 rows in the pixdata buffer
+    pixels_in_buffer = 100;
+    qp_internal_defer_rect(display, 0, 0, 19, 11, 0, 0, 255, true);
+
+    qp_internal_deferred_draw_task();
+    qp_internal_deferred_draw_task();
+    EXPECT_TRUE(qp_deferred_draw_pending());
+    qp_internal_deferred_draw_task();
+    std::vector<Drawn> expected = {{"fill", display, 0, 0, 19, 4}, {"fill", display, 0, 5, 19, 9}, {"fill", display, 0, 10, 19, 11}};
+    EXPECT_EQ(drawn, expected);
+    EXPECT_FALSE(qp_deferred_draw_pending());
+}
+
+TEST_F(QpDrawDeferred, AdjacentFills_Coalesced) {
+    // Rows of the same color, then the same columns extended sideways
+    qp_internal_defer_rect(display, 0, 0, 9, 0, 10, 20, 30, true);
+    qp_internal_defer_rect(display, 0, 1, 9, 1, 10, 20, 30, true);
+    qp_internal_defer_rect(display, 0, 2, 9, 3, 10, 20, 30, true);
+    qp_internal_defer_rect(display, 10, 0, 14, 3, 10, 20, 30, true);
+
+    qp_deferred_draw_sync();
+    std::vector<Drawn> expected = {{"fill", display, 0, 0, 14, 3}};
+    EXPECT_EQ(drawn, expected);
+}
+
+TEST_F(QpDrawDeferred, FillsThatDoNotMakeARectangle_NotCoalesced) {
+    qp_internal_defer_rect(display, 0, 0, 9, 0, 10, 20, 30, true);
+    // Different color
+    qp_internal_defer_rect(display, 0, 1, 9, 1, 10, 20, 31, true);
+    // Not adjacent
+    qp_internal_defer_rect(display, 0, 3, 9, 3, 10, 20, 31, true);
+    // Different width
+    qp_internal_defer_rect(display, 0, 4, 8, 4, 10, 20, 31, true);
+    // Different display
+    qp_internal_defer_rect(other, 0, 5, 8, 5, 10, 20, 31, true);
+
+    qp_deferred_draw_sync();
+    EXPECT_EQ(drawn.size(), 5u);
+}
+
+TEST_F(QpDrawDeferred, CoveredDraws_Discarded) {
+    painter_image_desc_t image = {4, 4, 1};
+    qp_internal_defer_line(display, 2, 2, 8, 8, 0, 0, 255);
+    qp_internal_defer_drawimage(display, 4, 4, &image, 0, 0, 255, 0, 0, 0);
+    qp_internal_defer_drawtext(display, 1, 1, &font, "a", 0, 0, 255, 0, 0, 0);
+    qp_internal_defer_rect(display, 0, 0, 9, 9, 0, 0, 0, true);
+
+    qp_deferred_draw_sync();
+    std::vector<Drawn> expected = {{"fill", display, 0, 0, 9, 9}};
+    EXPECT_EQ(drawn, expected);
+}
+
+TEST_F(QpDrawDeferred, PartlyCoveredDraws_Kept) {
+    // Crosses the edge of the fill
+    qp_internal_defer_line(display, 5, 5, 15, 5, 0, 0, 255);
+    // On another display
+    qp_internal_defer_line(other, 1, 1, 2, 2, 0, 0, 255);
+    // Larger than the outline, which is then covered itself
+    qp_internal_defer_rect(display, 0, 0, 11, 11, 0, 0, 255, false);
+    qp_internal_defer_rect(display, 1, 1, 8, 8, 0, 0, 0, false);
+    qp_internal_defer_rect(display, 0, 0, 9, 9, 0, 0, 0, true);
+
+    qp_deferred_draw_sync();
+    std::vector<Drawn> expected = {{"line", display, 5, 5, 15, 5}, {"line", other, 1, 1, 2, 2}, {"rect", display, 0, 0, 11, 11}, {"fill", display, 0, 0, 9, 9}};
+    EXPECT_EQ(drawn, expected);
+}
+
+TEST_F(QpDrawDeferred, LaterDraws_NotDiscarded) {
+    qp_internal_defer_rect(display, 0, 0, 9, 9, 0, 0, 0, true);
+    qp_internal_defer_line(display, 2, 2, 8, 8, 0, 0, 255);
+
+    qp_deferred_draw_sync();
+    std::vector<Drawn> expected = {{"fill", display, 0, 0, 9, 9}, {"line", display, 2, 2, 8, 8}};
+    EXPECT_EQ(drawn, expected);
+}
+
+TEST_F(QpDrawDeferred, ArenaFull_QueueDrawnFirst) {
+    size_t queued = 0;
+    while (drawn.empty()) {
+        qp_internal_defer_line(display, 0, queued, 9, queued, 0, 0, 255);
+        queued++;
+    }
+
+    // Everything before the command that did not fit has been drawn, in order
+    EXPECT_EQ(drawn.size(), queued - 1);
+    EXPECT_EQ(drawn.back(), (Drawn{"line", display, 0, (int)queued - 2, 9, (int)queued - 2}));
+    qp_deferred_draw_sync();
+    EXPECT_EQ(drawn.size(), queued);
+}
+
+TEST_F(QpDrawDeferred, Text_CopiedIntoTheQueue) {
+    char text[] = "hello";
+    EXPECT_EQ(qp_internal_defer_drawtext(display, 0, 0, &font, text, 0, 0, 255, 0, 0, 0), 30);
+    strcpy(text, "bye");
+
+    qp_deferred_draw_sync();
+    std::vector<Drawn> expected = {{"text hello", display, 0, 0, 29, 7}};
+    EXPECT_EQ(drawn, expected);
+}
+
+TEST_F(QpDrawDeferred, TextTooLongForTheQueue_DrawnAfterTheQueue) {
+    std::string text(QUANTUM_PAINTER_DEFERRED_ARENA_SIZE, 'x');
+    qp_internal_defer_line(display, 0, 0, 9, 0, 0, 0, 255);
+    qp_internal_defer_drawtext(display, 0, 10, &font, text.c_str(), 0, 0, 255, 0, 0, 0);
+
+    ASSERT_EQ(drawn.size(), 2u);
+    EXPECT_EQ(drawn[0].what, "line");
+    EXPECT_EQ(drawn[1].what, "text " + text);
+}
+
+TEST_F(QpDrawDeferred, Disabled_QueueDrawn) {
+    qp_internal_defer_line(display, 0, 0, 9, 0, 0, 0, 255);
+    qp_set_deferred_draw(false);
+    EXPECT_EQ(drawn.size(), 1u);
+    EXPECT_FALSE(qp_get_deferred_draw());
+}
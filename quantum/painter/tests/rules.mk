@@ -0,0 +1,6 @@
+qp_draw_deferred_DEFS := -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_DEFERRED_DRAW_ENABLE
+qp_draw_deferred_INC := $(QUANTUM_PATH)/painter
+
+qp_draw_deferred_SRC := \
+    $(QUANTUM_PATH)/painter/tests/qp_draw_deferred_tests.cpp \
+    $(QUANTUM_PATH)/painter/qp_draw_deferred.c
@@ -88,6 +88,23 @@ static pointing_device_status_t pointing_device_status     = POINTING_DEVICE_STA
 static uint16_t hires_scroll_resolution;
 #endif
 
+#ifdef POINTING_DEVICE_ACCUMULATE
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error POINTING_DEVICE_ACCUMULATE is not supported when sharing the pointing device report between sides.
+#    endif
+
+// Motion gathered since the last report, in 1/POINTING_DEVICE_MOTION_SCALE_UNIT counts
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+} pointing_device_accumulator_t;
+
+static pointing_device_accumulator_t accumulator  = {};
+static uint16_t                      motion_scale = POINTING_DEVICE_MOTION_SCALE_UNIT;
+#endif
+
 #define POINTING_DEVICE_DRIVER_CONCAT(name) name##_pointing_device_driver
 #define POINTING_DEVICE_DRIVER(name) POINTING_DEVICE_DRIVER_CONCAT(name)
 
@@ -288,6 +305,95 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+#ifdef POINTING_DEVICE_ACCUMULATE
+/**
+ * @brief Adds sensor counts to an accumulator axis, saturating instead of wrapping
+ */
+static int32_t accumulator_add(int32_t total, int16_t counts) {
+    int32_t delta = (int32_t)counts * motion_scale;
+    if (delta > 0 && total > INT32_MAX - delta) {
+        return INT32_MAX;
+    }
+    if (delta < 0 && total < INT32_MIN - delta) {
+        return INT32_MIN;
+    }
+    return total + delta;
+}
+
+/**
+ * @brief Takes as many whole counts from an accumulator axis as fit in the report
+ *
+ * The fraction, and anything beyond the report range, is left behind for the next report.
+ */
+static int32_t accumulator_take(int32_t *total, int32_t min, int32_t max) {
+    int32_t counts = *total / POINTING_DEVICE_MOTION_SCALE_UNIT;
+    if (counts < min) {
+        counts = min;
+    } else if (counts > max) {
+        counts = max;
+    }
+    *total -= counts * POINTING_DEVICE_MOTION_SCALE_UNIT;
+    return counts;
+}
+
+/**
+ * @brief Reads the sensor and adds its motion to the accumulator
+ *
+ * Called by pointing_device_task on every pass, and can be called more often by keyboards whose sensor
+ * needs to be read faster than the scan rate. Motion is only reported by pointing_device_task, once per
+ * POINTING_DEVICE_REPORT_INTERVAL_MS. Not safe to call from an interrupt.
+ */
+void pointing_device_sample(void) {
+#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+    static uint32_t last_exec = 0;
+    if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
+        return;
+    }
+    last_exec = timer_read32();
+#    endif
+
+    if (pointing_device_get_status() != POINTING_DEVICE_STATUS_SUCCESS) {
+        return;
+    }
+
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        else
+    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        endif
+        return;
+    }
+#    endif
+
+    report_mouse_t sample      = {.buttons = local_mouse_report.buttons};
+    sample                     = pointing_device_driver->get_report(sample);
+    local_mouse_report.buttons = sample.buttons;
+    accumulator.x              = accumulator_add(accumulator.x, sample.x);
+    accumulator.y              = accumulator_add(accumulator.y, sample.y);
+    accumulator.h              = accumulator_add(accumulator.h, sample.h);
+    accumulator.v              = accumulator_add(accumulator.v, sample.v);
+}
+
+/**
+ * @brief Sets the scale applied to sensor counts as they are accumulated
+ *
+ * @param[in] scale multiplier in 1/POINTING_DEVICE_MOTION_SCALE_UNIT, so POINTING_DEVICE_MOTION_SCALE_UNIT leaves counts unchanged
+ */
+void pointing_device_set_motion_scale(uint16_t scale) {
+    motion_scale = scale;
+}
+
+/**
+ * @brief Gets the scale applied to sensor counts as they are accumulated
+ *
+ * @return scale in 1/POINTING_DEVICE_MOTION_SCALE_UNIT
+ */
+uint16_t pointing_device_get_motion_scale(void) {
+    return motion_scale;
+}
+#endif
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
@@ -303,13 +409,32 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
-#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#ifdef POINTING_DEVICE_ACCUMULATE
+    pointing_device_sample();
+
+    // One merged report per interval, whatever the sensor rate
+    static uint32_t last_report = 0;
+    if (timer_elapsed32(last_report) < POINTING_DEVICE_REPORT_INTERVAL_MS) {
+        return false;
+    }
+    last_report = timer_read32();
+
+    if (pointing_device_get_status() != POINTING_DEVICE_STATUS_SUCCESS) {
+        return false;
+    }
+
+    local_mouse_report.x = accumulator_take(&accumulator.x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    local_mouse_report.y = accumulator_take(&accumulator.y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    local_mouse_report.h = accumulator_take(&accumulator.h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    local_mouse_report.v = accumulator_take(&accumulator.v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+#else
+#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return false;
     }
     last_exec = timer_read32();
-#endif
+#    endif
 
     if (pointing_device_get_status() != POINTING_DEVICE_STATUS_SUCCESS) {
         return false;
@@ -346,6 +471,7 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #ifdef POINTING_DEVICE_MOTION_PIN
     }
 #endif
+#endif // POINTING_DEVICE_ACCUMULATE
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
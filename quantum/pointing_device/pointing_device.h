@@ -136,6 +136,17 @@ void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
 uint16_t pointing_device_get_hires_scroll_resolution(void);
 #endif
 
+#ifdef POINTING_DEVICE_ACCUMULATE
+#    ifndef POINTING_DEVICE_REPORT_INTERVAL_MS
+#        define POINTING_DEVICE_REPORT_INTERVAL_MS 1
+#    endif
+#    define POINTING_DEVICE_MOTION_SCALE_UNIT 256
+
+void     pointing_device_sample(void);
+void     pointing_device_set_motion_scale(uint16_t scale);
+uint16_t pointing_device_get_motion_scale(void);
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
 uint16_t pointing_device_get_shared_cpi(void);
@@ -281,6 +281,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
 #endif
         // clang-format on
 #if TAP_CODE_DELAY > 0
+        host_keyboard_flush();
         wait_ms(TAP_CODE_DELAY);
 #endif
 
@@ -15,17 +15,22 @@
  */
 
 #include "process_combo.h"
+#include <limits.h>
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
 #include "wait.h"
+#include "host.h"
 #include "keyboard.h"
 #include "keymap_common.h"
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "task_scheduler.h"
 #include "keymap_introspection.h"
+#include "debug.h"
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -102,6 +107,22 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_KEY_INDEX_LENGTH
+/* Every key of every combo along with the combo it belongs to, sorted by
+ * keycode so that an event only has to visit the combos containing it. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_key_index_entry_t;
+static combo_key_index_entry_t combo_key_index[COMBO_KEY_INDEX_LENGTH];
+static uint16_t                combo_key_index_size   = 0;
+static bool                    combo_key_index_built  = false;
+static bool                    combo_key_index_usable = false;
+/* Combos visited since they were last reset, so that clearing does not have
+ * to walk all combos either. */
+static uint8_t combo_touched[(COMBO_KEY_INDEX_LENGTH + (CHAR_BIT)-1) / (CHAR_BIT)];
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -202,6 +223,28 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEY_INDEX_LENGTH
+    if (combo_key_index_usable) {
+        for (index = 0; index < combo_count(); ++index) {
+            const uint8_t bit = 1 << (index % (CHAR_BIT));
+            if (!combo_touched[index / (CHAR_BIT)]) {
+                // skip the whole byte
+                index |= (CHAR_BIT)-1;
+                continue;
+            }
+            if (!(combo_touched[index / (CHAR_BIT)] & bit)) {
+                continue;
+            }
+
+            combo_t *combo = combo_get(index);
+            if (!COMBO_ACTIVE(combo)) {
+                RESET_COMBO_STATE(combo);
+                combo_touched[index / (CHAR_BIT)] &= ~bit;
+            }
+        }
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -256,6 +299,7 @@ static inline void dump_key_buffer(void) {
         // only delay once and for a non-tapping key
         if (!delay_done && !is_tap_record(record)) {
             delay_done = true;
+            host_keyboard_flush();
             wait_ms(TAP_CODE_DELAY);
         }
 #endif
@@ -264,7 +308,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -551,9 +594,66 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+#ifdef COMBO_KEY_INDEX_LENGTH
+void combo_key_index_rebuild(void) {
+    combo_key_index_size   = 0;
+    combo_key_index_built  = true;
+    combo_key_index_usable = false;
+
+    if (combo_count() > COMBO_KEY_INDEX_LENGTH) {
+        dprintf("combo: COMBO_KEY_INDEX_LENGTH too small, checking all combos instead\n");
+        return;
+    }
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; i++) {
+            // insertion sort, entries of the same keycode stay in combo order
+            uint16_t pos = combo_key_index_size;
+            while (pos > 0 && combo_key_index[pos - 1].keycode > key) {
+                pos--;
+            }
+            if (pos > 0 && combo_key_index[pos - 1].keycode == key && combo_key_index[pos - 1].combo_index == idx) {
+                // keycode listed twice in the same combo
+                continue;
+            }
+            if (combo_key_index_size >= COMBO_KEY_INDEX_LENGTH) {
+                dprintf("combo: COMBO_KEY_INDEX_LENGTH too small, checking all combos instead\n");
+                return;
+            }
+
+            memmove(&combo_key_index[pos + 1], &combo_key_index[pos], (combo_key_index_size - pos) * sizeof(combo_key_index_entry_t));
+            combo_key_index[pos] = (combo_key_index_entry_t){
+                .keycode     = key,
+                .combo_index = idx,
+            };
+            combo_key_index_size++;
+        }
+    }
+
+    // the state of every combo is unknown, have the next clear reset them all
+    memset(combo_touched, 0xFF, sizeof(combo_touched));
+    combo_key_index_usable = true;
+}
+
+/* Returns the first index entry for the keycode, or the entry after where it would be. */
+static uint16_t combo_key_index_find(uint16_t keycode) {
+    uint16_t low = 0, high = combo_key_index_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_key_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +681,23 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX_LENGTH
+    if (!combo_key_index_built) {
+        combo_key_index_rebuild();
+    }
+
+    if (combo_key_index_usable) {
+        for (uint16_t i = combo_key_index_find(keycode); i < combo_key_index_size && combo_key_index[i].keycode == keycode; ++i) {
+            uint16_t idx = combo_key_index[i].combo_index;
+            combo_touched[idx / (CHAR_BIT)] |= 1 << (idx % (CHAR_BIT));
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -597,6 +710,7 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #    else
         timer = timer_read();
 #    endif
+        task_schedule_in(SCHEDULED_TASK_COMBO, 0);
 #endif
 
 #ifdef COMBO_PROCESS_KEY_REPRESS
@@ -633,16 +747,25 @@ void combo_task(void) {
     }
 
 #ifndef COMBO_NO_TIMER
-    if (timer && timer_elapsed(timer) > longest_term) {
-        if (combo_buffer_read != combo_buffer_write) {
-            apply_combos();
-            longest_term = 0;
-            timer        = 0;
-        } else {
-            dump_key_buffer();
-            timer = 0;
-            clear_combos();
-        }
+    if (!timer) {
+        return;
+    }
+
+    uint16_t elapsed = timer_elapsed(timer);
+    if (elapsed <= longest_term) {
+        // Check back once the longest combo term has run out
+        task_schedule_in(SCHEDULED_TASK_COMBO, longest_term - elapsed + 1);
+        return;
+    }
+
+    if (combo_buffer_read != combo_buffer_write) {
+        apply_combos();
+        longest_term = 0;
+        timer        = 0;
+    } else {
+        dump_key_buffer();
+        timer = 0;
+        clear_combos();
     }
 #endif
 }
@@ -81,3 +81,12 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEY_INDEX_LENGTH
+/**
+ * @brief Rebuilds the keycode to combo index. The index is built on the first
+ * key event, so this only needs to be called if the combos returned by
+ * `combo_count()`/`combo_get()` change afterwards.
+ */
+void combo_key_index_rebuild(void);
+#endif
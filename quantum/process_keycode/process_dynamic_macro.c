@@ -22,6 +22,7 @@
 #include "keycodes.h"
 #include "debug.h"
 #include "wait.h"
+#include "host.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -124,6 +125,7 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
         process_record(macro_buffer);
         macro_buffer += direction;
 #ifdef DYNAMIC_MACRO_DELAY
+        host_keyboard_flush();
         wait_ms(DYNAMIC_MACRO_DELAY);
 #endif
     }
@@ -22,6 +22,7 @@
 #include "timer.h"
 #include "wait.h"
 #include "keymap_introspection.h"
+#include "task_scheduler.h"
 
 static uint16_t active_td;
 static uint16_t last_tap_time;
@@ -45,6 +46,7 @@ void tap_dance_pair_reset(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
 
     if (state->count == 1) {
+        host_keyboard_flush();
         wait_ms(TAP_CODE_DELAY);
         unregister_code16(pair->kc1);
     } else if (state->count == 2) {
@@ -75,6 +77,7 @@ void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data) {
     tap_dance_dual_role_t *pair = (tap_dance_dual_role_t *)user_data;
 
     if (state->count == 1) {
+        host_keyboard_flush();
         wait_ms(TAP_CODE_DELAY);
         unregister_code16(pair->kc);
     }
@@ -167,6 +170,7 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
+                task_schedule_in(SCHEDULED_TASK_TAP_DANCE, 0);
             } else {
                 process_tap_dance_action_on_each_release(action);
                 if (action->state.finished) {
@@ -186,7 +190,15 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td) return;
+
+    uint16_t term    = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+    uint16_t elapsed = timer_elapsed(last_tap_time);
+    if (elapsed <= term) {
+        // Check back once the tapping term has run out
+        task_schedule_in(SCHEDULED_TASK_TAP_DANCE, term - elapsed + 1);
+        return;
+    }
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     if (!action->state.interrupted) {
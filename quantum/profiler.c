@@ -0,0 +1,230 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiler.h"
+#include "print.h"
+#include "util.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#elif defined(__AVR__)
+#    include "timer.h"
+#    include "timer_avr.h"
+#else
+#    include <time.h>
+#endif
+
+typedef struct {
+    const char *name;
+    uint8_t     parent;
+    uint8_t     depth;
+    uint8_t     next_sample;
+    uint8_t     sample_count;
+    uint32_t    count;
+    uint32_t    min;
+    uint32_t    max;
+    uint64_t    sum;
+    uint32_t    samples[PROFILER_SAMPLE_COUNT];
+} profiler_zone_t;
+
+typedef struct {
+    uint8_t  zone;
+    uint32_t start;
+} profiler_frame_t;
+
+static profiler_zone_t  zones[PROFILER_MAX_ZONES];
+static uint8_t          zone_count = 0;
+static profiler_frame_t stack[PROFILER_MAX_DEPTH];
+static uint16_t         stack_depth     = 0;
+static uint16_t         depth_overflows = 0;
+
+uint32_t profiler_timestamp(void) {
+#if defined(PROTOCOL_CHIBIOS)
+    return chSysGetRealtimeCounterX();
+#elif defined(__AVR__)
+    return timer_read32() * TIMER_RAW_TOP + TIMER_RAW;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#endif
+}
+
+static void zone_clear(profiler_zone_t *z) {
+    z->next_sample  = 0;
+    z->sample_count = 0;
+    z->count        = 0;
+    z->min          = UINT32_MAX;
+    z->max          = 0;
+    z->sum          = 0;
+}
+
+static uint8_t zone_register(const char *name) {
+    if (zone_count >= PROFILER_MAX_ZONES) {
+        return PROFILER_ZONE_UNREGISTERED;
+    }
+
+    profiler_zone_t *z = &zones[zone_count];
+    z->name            = name;
+    z->parent          = stack_depth ? stack[stack_depth - 1].zone : PROFILER_ZONE_UNREGISTERED;
+    z->depth           = stack_depth;
+    zone_clear(z);
+    return zone_count++;
+}
+
+void profiler_zone_begin(uint8_t *zone, const char *name) {
+    // Zones nested beyond the maximum depth are neither pushed nor registered,
+    // only counted so that begin/end stay balanced.
+    if (stack_depth >= PROFILER_MAX_DEPTH) {
+        if (stack_depth < UINT16_MAX) {
+            stack_depth++;
+        }
+        if (depth_overflows < UINT16_MAX) {
+            depth_overflows++;
+        }
+        return;
+    }
+
+    if (*zone == PROFILER_ZONE_UNREGISTERED) {
+        *zone = zone_register(name);
+    }
+    stack[stack_depth].zone  = *zone;
+    stack[stack_depth].start = profiler_timestamp();
+    stack_depth++;
+}
+
+void profiler_zone_end(void) {
+    const uint32_t end = profiler_timestamp();
+    if (stack_depth == 0) {
+        return;
+    }
+
+    // Zones beyond the maximum depth were not pushed, see profiler_zone_begin
+    stack_depth--;
+    if (stack_depth >= PROFILER_MAX_DEPTH || stack[stack_depth].zone == PROFILER_ZONE_UNREGISTERED) {
+        return;
+    }
+
+    profiler_zone_t *z       = &zones[stack[stack_depth].zone];
+    const uint32_t   elapsed = end - stack[stack_depth].start;
+
+    z->count++;
+    z->sum += elapsed;
+    z->min = MIN(z->min, elapsed);
+    z->max = MAX(z->max, elapsed);
+
+    z->samples[z->next_sample] = elapsed;
+    z->next_sample             = (z->next_sample + 1) % PROFILER_SAMPLE_COUNT;
+    if (z->sample_count < PROFILER_SAMPLE_COUNT) {
+        z->sample_count++;
+    }
+}
+
+uint8_t profiler_zone_count(void) {
+    return zone_count;
+}
+
+uint16_t profiler_depth_overflows(void) {
+    return depth_overflows;
+}
+
+static uint32_t zone_p99(const profiler_zone_t *z) {
+    if (z->sample_count == 0) {
+        return 0;
+    }
+
+    uint32_t sorted[PROFILER_SAMPLE_COUNT];
+    memcpy(sorted, z->samples, z->sample_count * sizeof(uint32_t));
+
+    // insertion sort, the ring is small
+    for (uint8_t i = 1; i < z->sample_count; i++) {
+        uint32_t v = sorted[i];
+        uint8_t  j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+
+    uint8_t index = (uint8_t)(((uint16_t)z->sample_count * 99 + 99) / 100) - 1;
+    return sorted[index];
+}
+
+bool profiler_get_zone_stats(uint8_t zone, profiler_zone_stats_t *stats) {
+    if (zone >= zone_count) {
+        return false;
+    }
+
+    const profiler_zone_t *z = &zones[zone];
+
+    stats->name   = z->name;
+    stats->parent = z->parent;
+    stats->depth  = z->depth;
+    stats->count  = z->count;
+    stats->min    = z->count ? z->min : 0;
+    stats->avg    = z->count ? (uint32_t)(z->sum / z->count) : 0;
+    stats->max    = z->max;
+    stats->p99    = zone_p99(z);
+    return true;
+}
+
+static uint8_t *write_u32(uint8_t *p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = (v >> 24) & 0xFF;
+    return p + 4;
+}
+
+bool profiler_get_zone_packet(uint8_t zone, uint8_t *data, uint8_t length) {
+    profiler_zone_stats_t stats;
+    if (length < 24 || !profiler_get_zone_stats(zone, &stats)) {
+        return false;
+    }
+
+    memset(data, 0, length);
+    uint8_t *p = data;
+    *p++       = PROFILER_RAW_HID_MARKER;
+    *p++       = zone;
+    *p++       = stats.parent;
+    *p++       = stats.depth;
+    p          = write_u32(p, stats.count);
+    p          = write_u32(p, stats.min);
+    p          = write_u32(p, stats.avg);
+    p          = write_u32(p, stats.max);
+    p          = write_u32(p, stats.p99);
+
+    // name is truncated, and not necessarily terminated if it fills the packet
+    const uint8_t remaining = length - (p - data);
+    strncpy((char *)p, stats.name, remaining);
+    return true;
+}
+
+static void dump_children(uint8_t parent) {
+    for (uint8_t i = 0; i < zone_count; i++) {
+        if (zones[i].parent != parent) {
+            continue;
+        }
+
+        profiler_zone_stats_t stats;
+        profiler_get_zone_stats(i, &stats);
+        for (uint8_t d = 0; d < stats.depth; d++) {
+            xprintf("  ");
+        }
+        xprintf("%s: n=%lu min=%lu avg=%lu max=%lu p99=%lu\n", stats.name, (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.avg, (unsigned long)stats.max, (unsigned long)stats.p99);
+        dump_children(i);
+    }
+}
+
+void profiler_dump(void) {
+    xprintf("profiler: %u zones, %u too deep\n", (unsigned)zone_count, (unsigned)depth_overflows);
+    dump_children(PROFILER_ZONE_UNREGISTERED);
+}
+
+void profiler_reset(void) {
+    depth_overflows = 0;
+    for (uint8_t i = 0; i < zone_count; i++) {
+        zone_clear(&zones[i]);
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    This API allows for hierarchical profiling of named zones.
+
+    Each zone keeps min/avg/max over its lifetime and a fixed-size ring of the
+    most recent samples from which the p99 is derived. Zones nest, a zone opened
+    while another one is active is reported as its child.
+
+    Usage example:
+
+        #include "profiler.h"
+
+        PROFILER_ZONE_BEGIN("my_task");
+        my_task();
+        PROFILER_ZONE_END();
+
+        // or, equivalently:
+        PROFILER_ZONE_CALL("my_task", my_task());
+
+    The collected data can be printed over console with `profiler_dump()`, or
+    retrieved zone by zone with `profiler_get_zone_stats()` -- e.g. for raw HID.
+
+    Timestamps are taken from the platform's fastest free running counter:
+    CPU cycles on ChibiOS (realtime counter), Timer0 ticks on AVR and
+    nanoseconds for the unit-test build.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef PROFILER_MAX_ZONES
+#    define PROFILER_MAX_ZONES 16
+#endif
+
+#ifndef PROFILER_MAX_DEPTH
+#    define PROFILER_MAX_DEPTH 8
+#endif
+
+#ifndef PROFILER_SAMPLE_COUNT
+#    define PROFILER_SAMPLE_COUNT 16
+#endif
+
+/**
+ * @brief Marker for a zone that has not been registered yet.
+ */
+#define PROFILER_ZONE_UNREGISTERED 0xFF
+
+/**
+ * @brief First byte of a raw HID profiler packet, see `profiler_get_zone_packet()`.
+ */
+#define PROFILER_RAW_HID_MARKER 0x50
+
+typedef struct {
+    const char *name;
+    uint8_t     parent; // PROFILER_ZONE_UNREGISTERED for root zones
+    uint8_t     depth;
+    uint32_t    count;
+    uint32_t    min;
+    uint32_t    avg;
+    uint32_t    max;
+    uint32_t    p99; // over the last PROFILER_SAMPLE_COUNT samples
+} profiler_zone_stats_t;
+
+#ifdef PROFILER_ENABLE
+
+/**
+ * @brief Opens a zone. The zone is registered on first use and identified by
+ * the `zone` storage thereafter.
+ */
+void profiler_zone_begin(uint8_t *zone, const char *name);
+
+/**
+ * @brief Closes the innermost open zone and records its duration.
+ */
+void profiler_zone_end(void);
+
+/**
+ * @brief Returns the current profiler timestamp.
+ */
+uint32_t profiler_timestamp(void);
+
+uint8_t profiler_zone_count(void);
+bool    profiler_get_zone_stats(uint8_t zone, profiler_zone_stats_t *stats);
+
+/**
+ * @brief Returns how many times a zone was opened nested deeper than
+ * `PROFILER_MAX_DEPTH`. Such zones are not recorded.
+ */
+uint16_t profiler_depth_overflows(void);
+
+/**
+ * @brief Serialises the statistics of one zone into a (raw HID sized) packet.
+ *
+ * Layout: marker, zone, parent, depth, count, min, avg, max, p99 (all
+ * little-endian uint32_t), followed by the zone name truncated to fit.
+ *
+ * @return false if the zone does not exist
+ */
+bool profiler_get_zone_packet(uint8_t zone, uint8_t *data, uint8_t length);
+
+/**
+ * @brief Prints all zones as a tree over console.
+ */
+void profiler_dump(void);
+
+/**
+ * @brief Clears the statistics of all zones, registrations are kept.
+ */
+void profiler_reset(void);
+
+#    define PROFILER_ZONE_BEGIN(name)                                      \
+        do {                                                               \
+            static uint8_t profiler_zone_id = PROFILER_ZONE_UNREGISTERED; \
+            profiler_zone_begin(&profiler_zone_id, (name));                \
+        } while (0)
+
+#    define PROFILER_ZONE_END() profiler_zone_end()
+
+#else
+
+#    define PROFILER_ZONE_BEGIN(name) \
+        do {                          \
+        } while (0)
+
+#    define PROFILER_ZONE_END() \
+        do {                    \
+        } while (0)
+
+#endif // PROFILER_ENABLE
+
+#define PROFILER_ZONE_CALL(name, call) \
+    do {                               \
+        PROFILER_ZONE_BEGIN(name);     \
+        do {                           \
+            call;                      \
+        } while (0);                   \
+        PROFILER_ZONE_END();           \
+    } while (0)
@@ -93,6 +93,10 @@
 #    include "process_oneshot.h"
 #endif
 
+#if defined(EEPROM_WEAR_LEVELING) && defined(WEAR_LEVELING_WRITE_BACK)
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -156,7 +160,12 @@ __attribute__((weak)) void unregister_code16(uint16_t code) {
  * \param delay The amount of time in milliseconds to leave the keycode registered, before unregistering it.
  */
 __attribute__((weak)) void tap_code16_delay(uint16_t code, uint16_t delay) {
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_NONBLOCKING)
+    // Type out queued strings first, or the tap would overtake them
+    send_string_flush();
+#endif
     register_code16(code);
+    host_keyboard_flush();
     for (uint16_t i = delay; i > 0; i--) {
         wait_ms(1);
     }
@@ -235,6 +244,10 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#if defined(EEPROM_WEAR_LEVELING) && defined(WEAR_LEVELING_WRITE_BACK)
+    // Commit buffered EEPROM writes before resetting
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -485,6 +498,10 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 void suspend_power_down_quantum(void) {
     suspend_power_down_modules();
     suspend_power_down_kb();
+#if defined(EEPROM_WEAR_LEVELING) && defined(WEAR_LEVELING_WRITE_BACK)
+    // Commit buffered EEPROM writes, the host may cut power while suspended
+    eeprom_driver_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
@@ -45,6 +45,7 @@
 #include "bootloader.h"
 #include "timer.h"
 #include "sync_timer.h"
+#include "task_scheduler.h"
 #include "gpio.h"
 #include "atomic_util.h"
 #include "host.h"
@@ -8,14 +8,33 @@ bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, react
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     uint8_t count = g_last_hit_tracker.count;
+#    ifdef RGB_MATRIX_SPATIAL_INDEX
+    // The neighbors of each hit are sorted by LED index, so one cursor per hit
+    // walks them alongside `i`.
+    const led_neighbor_t* neighbors[LED_HITS_TO_REMEMBER];
+    uint16_t              neighbor_count[LED_HITS_TO_REMEMBER];
+    uint16_t              cursor[LED_HITS_TO_REMEMBER] = {0};
+    for (uint8_t j = start; j < count; j++) {
+        if (!rgb_matrix_led_neighbors(g_last_hit_tracker.index[j], &neighbors[j], &neighbor_count[j])) {
+            neighbor_count[j] = 0;
+        }
+    }
+#    endif
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         hsv_t hsv = rgb_matrix_config.hsv;
         hsv.v     = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
+            int16_t dx = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+#    ifdef RGB_MATRIX_SPATIAL_INDEX
+            while (cursor[j] < neighbor_count[j] && neighbors[j][cursor[j]].led < i) {
+                cursor[j]++;
+            }
+            uint8_t dist = cursor[j] < neighbor_count[j] && neighbors[j][cursor[j]].led == i ? neighbors[j][cursor[j]].dist : sqrt16(dx * dx + dy * dy);
+#    else
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+#    endif
             uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
             hsv           = effect_func(hsv, dx, dy, dist, tick);
         }
@@ -24,6 +24,27 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+#            if defined(RGB_MATRIX_SPATIAL_INDEX) && RGB_MATRIX_SPATIAL_INDEX_RADIUS >= RGB_MATRIX_TYPING_HEATMAP_SPREAD
+    // only visit the keys within reach, if the pressed key is indexed
+    const led_neighbor_t* neighbors;
+    uint16_t              neighbor_count;
+    uint8_t               led = g_led_config.matrix_co[row][col];
+    if (rgb_matrix_led_matrix_positions_unique() && rgb_matrix_led_neighbors(led, &neighbors, &neighbor_count)) {
+        for (uint16_t i = 0; i < neighbor_count; i++) {
+            uint8_t i_row, i_col;
+            if (neighbors[i].led == led) {
+                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+            } else if (neighbors[i].dist <= RGB_MATRIX_TYPING_HEATMAP_SPREAD && rgb_matrix_led_matrix_position(neighbors[i].led, &i_row, &i_col)) {
+                uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, neighbors[i].dist);
+                if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+                    amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+                }
+                g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+            }
+        }
+        return;
+    }
+#            endif
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
@@ -479,6 +479,14 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+#ifdef RGB_MATRIX_WS2812
+    // The LEDs hold whatever they had before, send all of them on the first flush
+    ws2812_invalidate();
+#endif
+
+#ifdef RGB_MATRIX_SPATIAL_INDEX
+    rgb_matrix_spatial_index_build();
+#endif // RGB_MATRIX_SPATIAL_INDEX
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
@@ -501,6 +509,12 @@ void rgb_matrix_init(void) {
 }
 
 void rgb_matrix_set_suspend_state(bool state) {
+#ifdef RGB_MATRIX_WS2812
+    // The LEDs may have lost power while suspended
+    if (!state) {
+        ws2812_invalidate();
+    }
+#endif
 #ifdef RGB_MATRIX_SLEEP
     if (state && !suspend_state) { // only run if turning off, and only once
         rgb_task_render(0);        // turn off all LEDs when suspending
@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include "rgb_matrix_types.h"
 #include "rgb_matrix_drivers.h"
+#include "rgb_matrix_spatial_index.h"
 #include "color.h"
 #include "keyboard.h"
 
@@ -0,0 +1,101 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include "rgb_matrix_spatial_index.h"
+#include <string.h>
+
+#include <lib/lib8tion/lib8tion.h>
+
+#ifdef RGB_MATRIX_SPATIAL_INDEX
+
+#    define NO_POSITION 0xFF
+#    define MULTIPLE_POSITIONS 0xFE
+
+static led_neighbor_t neighbor_table[RGB_MATRIX_SPATIAL_INDEX_SIZE];
+static uint16_t       neighbor_offset[RGB_MATRIX_LED_COUNT + 1];
+static uint8_t        indexed_leds;
+static uint8_t        led_row[RGB_MATRIX_LED_COUNT];
+static uint8_t        led_col[RGB_MATRIX_LED_COUNT];
+static bool           positions_unique;
+
+uint8_t rgb_matrix_led_distance(uint8_t led_a, uint8_t led_b) {
+    int16_t dx = g_led_config.point[led_a].x - g_led_config.point[led_b].x;
+    int16_t dy = g_led_config.point[led_a].y - g_led_config.point[led_b].y;
+    return sqrt16(dx * dx + dy * dy);
+}
+
+void rgb_matrix_spatial_index_build(void) {
+    uint16_t size = 0;
+
+    indexed_leds       = 0;
+    neighbor_offset[0] = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        uint16_t count = 0;
+        for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT; j++) {
+            uint8_t dist = rgb_matrix_led_distance(i, j);
+            if (dist > RGB_MATRIX_SPATIAL_INDEX_RADIUS) {
+                continue;
+            }
+            if (size + count >= RGB_MATRIX_SPATIAL_INDEX_SIZE) {
+                count = UINT16_MAX;
+                break;
+            }
+            neighbor_table[size + count] = (led_neighbor_t){.led = j, .dist = dist};
+            count++;
+        }
+        // LEDs that did not fit are left out entirely
+        if (count == UINT16_MAX) {
+            break;
+        }
+
+        size += count;
+        neighbor_offset[i + 1] = size;
+        indexed_leds++;
+    }
+
+    positions_unique = true;
+    memset(led_row, NO_POSITION, sizeof(led_row));
+    memset(led_col, NO_POSITION, sizeof(led_col));
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led >= RGB_MATRIX_LED_COUNT) {
+                continue;
+            }
+            if (led_row[led] != NO_POSITION) {
+                positions_unique = false;
+                led_row[led]     = MULTIPLE_POSITIONS;
+                continue;
+            }
+            led_row[led] = row;
+            led_col[led] = col;
+        }
+    }
+}
+
+bool rgb_matrix_led_neighbors(uint8_t led, const led_neighbor_t **neighbors, uint16_t *count) {
+    if (led >= indexed_leds) {
+        return false;
+    }
+
+    *neighbors = &neighbor_table[neighbor_offset[led]];
+    *count     = neighbor_offset[led + 1] - neighbor_offset[led];
+    return true;
+}
+
+bool rgb_matrix_led_matrix_position(uint8_t led, uint8_t *row, uint8_t *col) {
+    if (led >= RGB_MATRIX_LED_COUNT || led_row[led] == NO_POSITION || led_row[led] == MULTIPLE_POSITIONS) {
+        return false;
+    }
+
+    *row = led_row[led];
+    *col = led_col[led];
+    return true;
+}
+
+bool rgb_matrix_led_matrix_positions_unique(void) {
+    return positions_unique;
+}
+
+#endif // RGB_MATRIX_SPATIAL_INDEX
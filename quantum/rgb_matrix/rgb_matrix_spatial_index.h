@@ -0,0 +1,68 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/*
+    Table of the distances between LEDs, derived from `g_led_config.point`.
+
+    For every LED the neighbors within RGB_MATRIX_SPATIAL_INDEX_RADIUS are
+    stored, sorted by LED index and including the LED itself. The table holds
+    up to RGB_MATRIX_SPATIAL_INDEX_SIZE neighbors in total (2 bytes each);
+    once it is full the remaining LEDs are left unindexed and effects fall
+    back to computing their distances.
+
+    The reactive splash effects and the typing heatmap use the table to avoid
+    computing a square root for every LED on every key hit.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "compiler_support.h"
+
+#ifndef RGB_MATRIX_SPATIAL_INDEX_RADIUS
+#    define RGB_MATRIX_SPATIAL_INDEX_RADIUS 40
+#endif
+
+#ifndef RGB_MATRIX_SPATIAL_INDEX_SIZE
+#    define RGB_MATRIX_SPATIAL_INDEX_SIZE 512
+#endif
+
+#if RGB_MATRIX_SPATIAL_INDEX_RADIUS > UINT8_MAX
+#    error RGB_MATRIX_SPATIAL_INDEX_RADIUS must be 255 or less
+#endif
+
+typedef struct PACKED {
+    uint8_t led;
+    uint8_t dist;
+} led_neighbor_t;
+
+/**
+ * \brief Builds the table from `g_led_config`. Called by `rgb_matrix_init()`,
+ * call it again if the LED positions are changed at runtime.
+ */
+void rgb_matrix_spatial_index_build(void);
+
+/**
+ * \brief Distance between two LEDs, as used by the effects.
+ */
+uint8_t rgb_matrix_led_distance(uint8_t led_a, uint8_t led_b);
+
+/**
+ * \brief Looks up the neighbors of an LED.
+ *
+ * \return false if the LED did not fit into the table
+ */
+bool rgb_matrix_led_neighbors(uint8_t led, const led_neighbor_t **neighbors, uint16_t *count);
+
+/**
+ * \brief Looks up the matrix position of an LED.
+ *
+ * \return false if the LED has no matrix position, or several of them
+ */
+bool rgb_matrix_led_matrix_position(uint8_t led, uint8_t *row, uint8_t *col);
+
+/**
+ * \brief Returns false if any LED is assigned to several matrix positions.
+ */
+bool rgb_matrix_led_matrix_positions_unique(void);
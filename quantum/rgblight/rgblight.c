@@ -25,6 +25,9 @@
 #include "led_tables.h"
 #include <lib/lib8tion/lib8tion.h>
 #include "eeconfig.h"
+#ifdef RGBLIGHT_WS2812
+#    include "ws2812.h"
+#endif
 
 #ifdef RGBLIGHT_SPLIT
 /* for split keyboard */
@@ -225,6 +228,10 @@ void rgblight_init(void) {
     rgblight_timer_init(); // setup the timer
 
     rgblight_driver.init();
+#ifdef RGBLIGHT_WS2812
+    // The LEDs hold whatever they had before, send all of them on the first flush
+    ws2812_invalidate();
+#endif
 
     if (rgblight_config.enable) {
         rgblight_mode_noeeprom(rgblight_config.mode);
@@ -842,6 +849,10 @@ void rgblight_suspend(void) {
 
 void rgblight_wakeup(void) {
     is_suspended = false;
+#    ifdef RGBLIGHT_WS2812
+    // The LEDs may have lost power while suspended
+    ws2812_invalidate();
+#    endif
 
     if (pre_suspend_enabled) {
         rgblight_enable_noeeprom();
@@ -4,6 +4,7 @@
 #include "secure.h"
 #include "timer.h"
 #include "util.h"
+#include "task_scheduler.h"
 
 #ifndef SECURE_UNLOCK_TIMEOUT
 #    define SECURE_UNLOCK_TIMEOUT 5000
@@ -41,6 +42,7 @@ void secure_lock(void) {
 void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
     idle_time     = timer_read32();
+    task_schedule_in(SCHEDULED_TASK_SECURE, 0);
     secure_hook(secure_status);
 }
 
@@ -48,6 +50,7 @@ void secure_request_unlock(void) {
     if (secure_status == SECURE_LOCKED) {
         secure_status = SECURE_PENDING;
         unlock_time   = timer_read32();
+        task_schedule_in(SCHEDULED_TASK_SECURE, 0);
     }
     secure_hook(secure_status);
 }
@@ -55,6 +58,7 @@ void secure_request_unlock(void) {
 void secure_activity_event(void) {
     if (secure_status == SECURE_UNLOCKED) {
         idle_time = timer_read32();
+        task_schedule_in(SCHEDULED_TASK_SECURE, 0);
     }
 }
 
@@ -79,8 +83,11 @@ void secure_task(void) {
 #if SECURE_UNLOCK_TIMEOUT != 0
     // handle unlock timeout
     if (secure_status == SECURE_PENDING) {
-        if (timer_elapsed32(unlock_time) >= SECURE_UNLOCK_TIMEOUT) {
+        uint32_t elapsed = timer_elapsed32(unlock_time);
+        if (elapsed >= SECURE_UNLOCK_TIMEOUT) {
             secure_lock();
+        } else {
+            task_schedule_in(SCHEDULED_TASK_SECURE, SECURE_UNLOCK_TIMEOUT - elapsed);
         }
     }
 #endif
@@ -88,8 +95,11 @@ void secure_task(void) {
 #if SECURE_IDLE_TIMEOUT != 0
     // handle idle timeout
     if (secure_status == SECURE_UNLOCKED) {
-        if (timer_elapsed32(idle_time) >= SECURE_IDLE_TIMEOUT) {
+        uint32_t elapsed = timer_elapsed32(idle_time);
+        if (elapsed >= SECURE_IDLE_TIMEOUT) {
             secure_lock();
+        } else {
+            task_schedule_in(SCHEDULED_TASK_SECURE, SECURE_IDLE_TIMEOUT - elapsed);
         }
     }
 #endif
@@ -23,6 +23,28 @@
 #include "keycode.h"
 #include "action.h"
 #include "wait.h"
+#include "host.h"
+
+#ifdef SEND_STRING_NONBLOCKING
+#    include "timer.h"
+#    include "util.h"
+#    include "compiler_support.h"
+
+#    ifndef SEND_STRING_QUEUE_SIZE
+#        define SEND_STRING_QUEUE_SIZE 128
+#    endif
+
+// Minimum time between two reports -- sending faster than the host polls would overwrite reports before they are sent
+#    ifndef SEND_STRING_NONBLOCKING_INTERVAL
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define SEND_STRING_NONBLOCKING_INTERVAL USB_POLLING_INTERVAL_MS
+#        else
+#            define SEND_STRING_NONBLOCKING_INTERVAL 1
+#        endif
+#    endif
+
+STATIC_ASSERT(SEND_STRING_QUEUE_SIZE >= 16 && SEND_STRING_QUEUE_SIZE <= UINT16_MAX, "SEND_STRING_QUEUE_SIZE must be between 16 and 65535");
+#endif
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
@@ -150,6 +172,233 @@ void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
+#ifdef SEND_STRING_NONBLOCKING
+/*
+ * Strings are decoded into actions when they are sent, and the actions are stored in a ring buffer. send_string_task()
+ * then performs one step -- usually a single key press or release -- at a time, so the keyboard keeps scanning while a
+ * string is being typed. Only once the buffer is full does sending block, until enough of it has been typed.
+ *
+ * Actions, one opcode byte followed by its arguments:
+ *   - any other byte:              type the character
+ *   - SS_TAP_CODE, keycode:        tap the keycode
+ *   - SS_DOWN_CODE, keycode:       press the keycode
+ *   - SS_UP_CODE, keycode:         release the keycode
+ *   - SS_DELAY_CODE, lsb, msb:     wait for the given time
+ *   - QUEUE_INTERVAL_CODE, value:  set the interval for the following actions
+ */
+#    define QUEUE_INTERVAL_CODE 5
+#    define QUEUE_MAX_STEPS 8
+
+enum { QUEUE_STEP_NONE, QUEUE_STEP_DOWN, QUEUE_STEP_UP, QUEUE_STEP_BELL };
+
+typedef struct send_string_queue_step_t {
+    uint8_t  type;
+    uint8_t  keycode;
+    uint16_t wait; // before the next step
+} send_string_queue_step_t;
+
+static struct {
+    uint8_t                  buffer[SEND_STRING_QUEUE_SIZE];
+    uint16_t                 head;
+    uint16_t                 count;
+    uint8_t                  enqueue_interval;
+    uint8_t                  interval;
+    send_string_queue_step_t steps[QUEUE_MAX_STEPS];
+    uint8_t                  step_count;
+    uint8_t                  step_index;
+    uint16_t                 last_step_time;
+    uint16_t                 wait;
+} queue;
+
+static uint8_t send_string_queue_get(void) {
+    uint8_t value = queue.buffer[queue.head];
+    queue.head    = (queue.head + 1) % SEND_STRING_QUEUE_SIZE;
+    queue.count--;
+    return value;
+}
+
+static void send_string_queue_add_step(uint8_t type, uint8_t keycode, uint16_t wait) {
+    queue.steps[queue.step_count++] = (send_string_queue_step_t){.type = type, .keycode = keycode, .wait = wait};
+}
+
+// Mirrors send_char_with_delay()
+static void send_string_queue_add_char_steps(char ascii_code) {
+    uint8_t interval = queue.interval;
+
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        send_string_queue_add_step(QUEUE_STEP_BELL, 0, 0);
+        return;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) {
+        send_string_queue_add_step(QUEUE_STEP_DOWN, KC_LEFT_SHIFT, interval);
+    }
+    if (is_altgred) {
+        send_string_queue_add_step(QUEUE_STEP_DOWN, KC_RIGHT_ALT, interval);
+    }
+    send_string_queue_add_step(QUEUE_STEP_DOWN, keycode, interval);
+    send_string_queue_add_step(QUEUE_STEP_UP, keycode, interval);
+    if (is_altgred) {
+        send_string_queue_add_step(QUEUE_STEP_UP, KC_RIGHT_ALT, interval);
+    }
+    if (is_shifted) {
+        send_string_queue_add_step(QUEUE_STEP_UP, KC_LEFT_SHIFT, interval);
+    }
+    if (is_dead) {
+        send_string_queue_add_step(QUEUE_STEP_DOWN, KC_SPACE, TAP_CODE_DELAY);
+        send_string_queue_add_step(QUEUE_STEP_UP, KC_SPACE, interval);
+    }
+}
+
+// Turns the next action into steps, returns false if there is none
+static bool send_string_queue_load(void) {
+    queue.step_count = 0;
+    queue.step_index = 0;
+
+    while (queue.step_count == 0 && queue.count > 0) {
+        uint8_t action = send_string_queue_get();
+        switch (action) {
+            case SS_TAP_CODE: {
+                uint8_t keycode = send_string_queue_get();
+                send_string_queue_add_step(QUEUE_STEP_DOWN, keycode, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+                send_string_queue_add_step(QUEUE_STEP_UP, keycode, queue.interval);
+            } break;
+            case SS_DOWN_CODE:
+                send_string_queue_add_step(QUEUE_STEP_DOWN, send_string_queue_get(), queue.interval);
+                break;
+            case SS_UP_CODE:
+                send_string_queue_add_step(QUEUE_STEP_UP, send_string_queue_get(), queue.interval);
+                break;
+            case SS_DELAY_CODE: {
+                uint16_t ms = send_string_queue_get();
+                ms |= (uint16_t)send_string_queue_get() << 8;
+                send_string_queue_add_step(QUEUE_STEP_NONE, 0, ms + queue.interval);
+            } break;
+            case QUEUE_INTERVAL_CODE:
+                queue.interval = send_string_queue_get();
+                break;
+            default:
+                send_string_queue_add_char_steps(action);
+                break;
+        }
+    }
+
+    return queue.step_count > 0;
+}
+
+static void send_string_queue_step(void) {
+    if (queue.step_index >= queue.step_count && !send_string_queue_load()) {
+        return;
+    }
+
+    send_string_queue_step_t *step = &queue.steps[queue.step_index++];
+    queue.wait                     = step->wait;
+    switch (step->type) {
+        case QUEUE_STEP_DOWN:
+            register_code(step->keycode);
+            queue.wait = MAX(queue.wait, SEND_STRING_NONBLOCKING_INTERVAL);
+            break;
+        case QUEUE_STEP_UP:
+            unregister_code(step->keycode);
+            queue.wait = MAX(queue.wait, SEND_STRING_NONBLOCKING_INTERVAL);
+            break;
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+        case QUEUE_STEP_BELL:
+            PLAY_SONG(bell_song);
+            break;
+#    endif
+    }
+    queue.last_step_time = timer_read();
+}
+
+// Performs the next step as soon as it is due, for when sending cannot be deferred any longer
+static void send_string_queue_step_blocking(void) {
+    uint16_t elapsed = timer_elapsed(queue.last_step_time);
+    if (elapsed < queue.wait) {
+        host_keyboard_flush();
+        wait_ms(queue.wait - elapsed);
+    }
+    send_string_queue_step();
+}
+
+static void send_string_queue_put(uint8_t value) {
+    while (queue.count >= SEND_STRING_QUEUE_SIZE) {
+        send_string_queue_step_blocking();
+    }
+    queue.buffer[(queue.head + queue.count) % SEND_STRING_QUEUE_SIZE] = value;
+    queue.count++;
+}
+
+static void send_string_queue_set_interval(uint8_t interval) {
+    if (interval != queue.enqueue_interval) {
+        send_string_queue_put(QUEUE_INTERVAL_CODE);
+        send_string_queue_put(interval);
+        queue.enqueue_interval = interval;
+    }
+}
+
+bool send_string_pending(void) {
+    return queue.count > 0 || queue.step_index < queue.step_count;
+}
+
+void send_string_flush(void) {
+    while (send_string_pending()) {
+        send_string_queue_step_blocking();
+    }
+}
+
+void send_string_task(void) {
+    if (send_string_pending() && timer_elapsed(queue.last_step_time) >= queue.wait) {
+        send_string_queue_step();
+    }
+}
+
+void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    send_string_queue_set_interval(interval);
+    while (1) {
+        char ascii_code = getter(arg);
+        if (!ascii_code) break;
+        if (ascii_code == SS_QMK_PREFIX) {
+            ascii_code = getter(arg);
+
+            if (ascii_code == SS_TAP_CODE || ascii_code == SS_DOWN_CODE || ascii_code == SS_UP_CODE) {
+                // tap, down, up
+                uint8_t keycode = getter(arg);
+                send_string_queue_put(ascii_code);
+                send_string_queue_put(keycode);
+            } else {
+                // delay, or just the interval for unknown codes
+                uint32_t ms = 0;
+                if (ascii_code == SS_DELAY_CODE) {
+                    ascii_code = getter(arg);
+                    while (isdigit(ascii_code)) {
+                        ms *= 10;
+                        ms += ascii_code - '0';
+                        ascii_code = getter(arg);
+                    }
+                }
+                ms = MIN(ms, UINT16_MAX - UINT8_MAX);
+                send_string_queue_put(SS_DELAY_CODE);
+                send_string_queue_put(ms & 0xFF);
+                send_string_queue_put(ms >> 8);
+            }
+
+            // if we had a delay that terminated with a null, we're done
+            if (ascii_code == 0) break;
+        } else if ((uint8_t)ascii_code > QUEUE_INTERVAL_CODE) {
+            // characters overlapping with the action codes do not map to a keycode anyway
+            send_string_queue_put(ascii_code);
+        }
+    }
+}
+#else
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
     while (1) {
         char ascii_code = getter(arg);
@@ -180,9 +429,11 @@ void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t inte
                     ascii_code = getter(arg);
                 }
 
+                host_keyboard_flush();
                 wait_ms(ms);
             }
 
+            host_keyboard_flush();
             wait_ms(interval);
 
             // if we had a delay that terminated with a null, we're done
@@ -192,6 +443,7 @@ void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t inte
         }
     }
 }
+#endif
 
 typedef struct send_string_memory_state_t {
     const char *string;
@@ -214,6 +466,15 @@ void send_char(char ascii_code) {
 }
 
 void send_char_with_delay(char ascii_code, uint8_t interval) {
+#ifdef SEND_STRING_NONBLOCKING
+    // Keep the order with respect to strings still being typed
+    if ((uint8_t)ascii_code > QUEUE_INTERVAL_CODE) {
+        send_string_queue_set_interval(interval);
+        send_string_queue_put(ascii_code);
+    }
+    return;
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
         PLAY_SONG(bell_song);
@@ -228,29 +489,35 @@ void send_char_with_delay(char ascii_code, uint8_t interval) {
 
     if (is_shifted) {
         register_code(KC_LEFT_SHIFT);
+        host_keyboard_flush();
         wait_ms(interval);
     }
 
     if (is_altgred) {
         register_code(KC_RIGHT_ALT);
+        host_keyboard_flush();
         wait_ms(interval);
     }
 
     tap_code_delay(keycode, interval);
+    host_keyboard_flush();
     wait_ms(interval);
 
     if (is_altgred) {
         unregister_code(KC_RIGHT_ALT);
+        host_keyboard_flush();
         wait_ms(interval);
     }
 
     if (is_shifted) {
         unregister_code(KC_LEFT_SHIFT);
+        host_keyboard_flush();
         wait_ms(interval);
     }
 
     if (is_dead) {
         tap_code(KC_SPACE);
+        host_keyboard_flush();
         wait_ms(interval);
     }
 }
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -169,4 +170,23 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+#if defined(SEND_STRING_NONBLOCKING) || defined(__DOXYGEN__)
+/**
+ * \brief Whether any sent strings or characters are still being typed.
+ *
+ * Only available with `SEND_STRING_NONBLOCKING`, where sending only queues the keystrokes.
+ */
+bool send_string_pending(void);
+
+/**
+ * \brief Types out everything that is still queued, blocking until done.
+ */
+void send_string_flush(void);
+
+/**
+ * \brief Types out the next queued keystroke once it is due. Called from `keyboard_task()`.
+ */
+void send_string_task(void);
+#endif
+
 /** \} */
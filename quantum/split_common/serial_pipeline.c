@@ -0,0 +1,272 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "compiler_support.h"
+#include "crc.h"
+#include "serial_pipeline.h"
+
+// Sequence numbers wrap, and a repeated frame is told apart from a new one by how far behind it is
+STATIC_ASSERT(SERIAL_PIPELINE_WINDOW > 0 && SERIAL_PIPELINE_WINDOW < 128, "SERIAL_PIPELINE_WINDOW must be between 1 and 127");
+STATIC_ASSERT(SERIAL_PIPELINE_PAYLOAD_SIZE <= UINT8_MAX, "SERIAL_PIPELINE_PAYLOAD_SIZE must fit in a frame");
+
+static void send_frame(serial_pipeline_t *pipeline, uint8_t seq, uint8_t kind, const uint8_t *payload, uint8_t length) {
+    uint8_t *frame = pipeline->tx_frame;
+    frame[0]       = SERIAL_PIPELINE_SOF;
+    frame[1]       = seq;
+    frame[2]       = kind;
+    frame[3]       = length;
+    if (payload != &frame[SERIAL_PIPELINE_HEADER_SIZE]) {
+        memcpy(&frame[SERIAL_PIPELINE_HEADER_SIZE], payload, length);
+    }
+    frame[SERIAL_PIPELINE_HEADER_SIZE + length] = crc8(&frame[1], SERIAL_PIPELINE_HEADER_SIZE - 1 + length);
+    // A frame that does not make it out is treated like one lost on the way
+    (void)pipeline->io->send(frame, SERIAL_PIPELINE_HEADER_SIZE + length + 1);
+}
+
+static inline serial_pipeline_slot_t *slot_at(serial_pipeline_t *pipeline, uint8_t index) {
+    return &pipeline->slots[(pipeline->oldest + index) % SERIAL_PIPELINE_WINDOW];
+}
+
+////////////////////////////////////////////////////
+// Master
+
+void serial_pipeline_init_master(serial_pipeline_t *pipeline, const serial_pipeline_io_t *io) {
+    memset(pipeline, 0, sizeof(serial_pipeline_t));
+    pipeline->io     = io;
+    pipeline->window = SERIAL_PIPELINE_WINDOW;
+    pipeline->resync = true;
+}
+
+static void retransmit(serial_pipeline_t *pipeline) {
+    for (uint8_t i = 0; i < pipeline->count; ++i) {
+        serial_pipeline_slot_t *slot = slot_at(pipeline, i);
+        send_frame(pipeline, slot->seq, slot->kind, slot->request, slot->length);
+    }
+    pipeline->retransmissions += pipeline->count;
+    pipeline->sent_at = pipeline->io->now_us();
+}
+
+static void retry(serial_pipeline_t *pipeline) {
+    if (++pipeline->attempts > SERIAL_PIPELINE_RETRIES) {
+        // Give up on everything in flight, and have the slave start again from the next frame
+        pipeline->count    = 0;
+        pipeline->attempts = 0;
+        pipeline->resync   = true;
+        pipeline->failed   = true;
+        return;
+    }
+    retransmit(pipeline);
+}
+
+static void handle_response(serial_pipeline_t *pipeline, uint8_t seq, uint8_t status, const uint8_t *payload, uint8_t length) {
+    if (pipeline->count == 0) {
+        return;
+    }
+    if (status == SERIAL_PIPELINE_NAK) {
+        retry(pipeline);
+        return;
+    }
+    if (status != SERIAL_PIPELINE_ACK) {
+        return;
+    }
+
+    uint8_t index = 0;
+    while (index < pipeline->count && slot_at(pipeline, index)->seq != seq) {
+        index++;
+    }
+    if (index == pipeline->count) {
+        return;
+    }
+
+    // Frames are applied in order, so this also acknowledges the writes before it
+    serial_pipeline_slot_t *slot = slot_at(pipeline, index);
+    if (slot->response_length) {
+        if (length != slot->response_length) {
+            return;
+        }
+        memcpy(slot->response, payload, length);
+    }
+    pipeline->oldest   = (pipeline->oldest + index + 1) % SERIAL_PIPELINE_WINDOW;
+    pipeline->count    = pipeline->count - (index + 1);
+    pipeline->attempts = 0;
+    pipeline->sent_at  = pipeline->io->now_us();
+}
+
+static bool wait(serial_pipeline_t *pipeline) {
+    pipeline->io->idle();
+    serial_pipeline_poll(pipeline);
+    if (pipeline->failed) {
+        pipeline->failed = false;
+        return false;
+    }
+    return true;
+}
+
+bool serial_pipeline_transaction(serial_pipeline_t *pipeline, uint8_t id, const uint8_t *request, uint8_t request_length, uint8_t *response, uint8_t response_length) {
+    serial_pipeline_poll(pipeline);
+    // A write that was already returned as done never made it
+    if (pipeline->failed) {
+        pipeline->failed = false;
+        return false;
+    }
+    while (pipeline->count >= pipeline->window) {
+        if (!wait(pipeline)) {
+            return false;
+        }
+    }
+
+    serial_pipeline_slot_t *slot = slot_at(pipeline, pipeline->count);
+    slot->seq                    = pipeline->next_seq++;
+    slot->kind                   = id | (pipeline->resync ? SERIAL_PIPELINE_RESYNC : 0);
+    slot->length                 = request_length;
+    slot->response               = response;
+    slot->response_length        = response_length;
+    pipeline->resync             = false;
+
+    bool posted = response_length == 0 && request_length <= SERIAL_PIPELINE_PAYLOAD_SIZE;
+    if (posted) {
+        memcpy(slot->copy, request, request_length);
+        slot->request = slot->copy;
+    } else {
+        slot->request = request;
+    }
+
+    if (pipeline->count++ == 0) {
+        pipeline->sent_at = pipeline->io->now_us();
+    }
+    send_frame(pipeline, slot->seq, slot->kind, slot->request, slot->length);
+    if (posted) {
+        return true;
+    }
+    return serial_pipeline_flush(pipeline);
+}
+
+bool serial_pipeline_flush(serial_pipeline_t *pipeline) {
+    while (pipeline->count) {
+        if (!wait(pipeline)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////
+// Slave
+
+void serial_pipeline_init_slave(serial_pipeline_t *pipeline, const serial_pipeline_io_t *io, serial_pipeline_handler_t handler) {
+    memset(pipeline, 0, sizeof(serial_pipeline_t));
+    pipeline->io      = io;
+    pipeline->handler = handler;
+}
+
+static void send_nak(serial_pipeline_t *pipeline) {
+    // The master sends everything again on the first one, so once is enough until that arrives
+    if (!pipeline->nak_sent) {
+        send_frame(pipeline, pipeline->expected_seq, SERIAL_PIPELINE_NAK, NULL, 0);
+        pipeline->nak_sent = true;
+    }
+}
+
+static void handle_request(serial_pipeline_t *pipeline, uint8_t seq, uint8_t kind, const uint8_t *payload, uint8_t length) {
+    uint8_t behind = pipeline->expected_seq - seq;
+    if (kind & SERIAL_PIPELINE_RESYNC) {
+        // Unless it is a repeat of the last one applied, the master has given up on the frames before it or
+        // restarted, even if the sequence number looks like that of a frame applied just before
+        if (!pipeline->synced || !pipeline->resync_repeatable || seq != pipeline->resync_seq) {
+            pipeline->expected_seq      = seq;
+            pipeline->synced            = true;
+            pipeline->resync_seq        = seq;
+            pipeline->resync_repeatable = true;
+            behind                      = 0;
+        }
+    } else if (!pipeline->synced) {
+        // Restarted while the master had frames in flight, which it has to give up on first
+        send_nak(pipeline);
+        return;
+    }
+
+    if (behind > SERIAL_PIPELINE_WINDOW) {
+        // Ahead of the next expected frame, which must have been lost
+        send_nak(pipeline);
+        return;
+    }
+
+    uint8_t *response        = &pipeline->tx_frame[SERIAL_PIPELINE_HEADER_SIZE];
+    uint8_t  response_length = 0;
+    if (!pipeline->handler(kind & ~SERIAL_PIPELINE_RESYNC, payload, length, response, &response_length, behind != 0)) {
+        send_nak(pipeline);
+        return;
+    }
+    if (behind == 0) {
+        pipeline->expected_seq++;
+        pipeline->nak_sent = false;
+        // The master only sends a frame a window past the resync once the resync has been acknowledged
+        if ((uint8_t)(pipeline->expected_seq - pipeline->resync_seq) > SERIAL_PIPELINE_WINDOW) {
+            pipeline->resync_repeatable = false;
+        }
+    }
+    send_frame(pipeline, seq, SERIAL_PIPELINE_ACK, response, response_length);
+}
+
+////////////////////////////////////////////////////
+// Both
+
+static void handle_frame(serial_pipeline_t *pipeline, uint16_t frame_length) {
+    const uint8_t *frame  = pipeline->rx_frame;
+    uint8_t        length = frame[3];
+    if (crc8(&frame[1], frame_length - 2) != frame[frame_length - 1]) {
+        if (pipeline->handler) {
+            send_nak(pipeline);
+        }
+        return;
+    }
+
+    if (pipeline->handler) {
+        handle_request(pipeline, frame[1], frame[2], &frame[SERIAL_PIPELINE_HEADER_SIZE], length);
+    } else {
+        handle_response(pipeline, frame[1], frame[2], &frame[SERIAL_PIPELINE_HEADER_SIZE], length);
+    }
+}
+
+void serial_pipeline_receive(serial_pipeline_t *pipeline, const uint8_t *data, size_t size) {
+    // Frames go out in one piece, so a gap means the rest of this one was lost, or its length was corrupted.
+    // Only the slave polls often enough to tell, the master may find a frame cut short by a long scan.
+    if (pipeline->handler) {
+        uint32_t now = pipeline->io->now_us();
+        if (pipeline->rx_length && (uint32_t)(now - pipeline->rx_at) >= SERIAL_PIPELINE_TIMEOUT_US / 2) {
+            pipeline->rx_length = 0;
+        }
+        pipeline->rx_at = now;
+    }
+
+    while (size--) {
+        uint8_t byte = *data++;
+        // Anything between frames is skipped, until the start of the next one
+        if (pipeline->rx_length == 0 && byte != SERIAL_PIPELINE_SOF) {
+            continue;
+        }
+        pipeline->rx_frame[pipeline->rx_length++] = byte;
+        if (pipeline->rx_length < SERIAL_PIPELINE_HEADER_SIZE) {
+            continue;
+        }
+        uint16_t frame_length = SERIAL_PIPELINE_HEADER_SIZE + pipeline->rx_frame[3] + 1;
+        if (pipeline->rx_length == frame_length) {
+            pipeline->rx_length = 0;
+            handle_frame(pipeline, frame_length);
+        }
+    }
+}
+
+void serial_pipeline_poll(serial_pipeline_t *pipeline) {
+    uint8_t buffer[16];
+    size_t  received;
+    while ((received = pipeline->io->receive(buffer, sizeof(buffer))) > 0) {
+        serial_pipeline_receive(pipeline, buffer, received);
+    }
+
+    if (!pipeline->handler && pipeline->count && (uint32_t)(pipeline->io->now_us() - pipeline->sent_at) >= SERIAL_PIPELINE_TIMEOUT_US) {
+        retry(pipeline);
+    }
+}
@@ -0,0 +1,172 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Runs split transactions over a full-duplex link without waiting for each one to be answered before
+// starting the next. Every frame, in both directions, is laid out as:
+//
+//     [SERIAL_PIPELINE_SOF] [sequence number] [kind] [length] [payload]... [crc8 of sequence number to payload]
+//
+// where the kind is the transaction id from the master, and SERIAL_PIPELINE_ACK or SERIAL_PIPELINE_NAK
+// from the slave. The slave applies frames strictly in sequence, acknowledging each with the
+// transaction's response. Writes are posted: the master keeps a copy of them and carries on, up to
+// SERIAL_PIPELINE_WINDOW unacknowledged frames. Anything that needs a response waits for it. On a
+// NAK, or no acknowledgement in time, every unacknowledged frame is sent again. Once the master gives
+// up on them, the next frame tells the slave to start again from there. The slave only takes such a
+// frame for a repeat while the master may still be sending it again, so a master that restarted is
+// followed from its first frame on.
+
+#ifndef SERIAL_PIPELINE_WINDOW
+#    define SERIAL_PIPELINE_WINDOW 4
+#endif // SERIAL_PIPELINE_WINDOW
+
+#ifndef SERIAL_PIPELINE_PAYLOAD_SIZE
+#    define SERIAL_PIPELINE_PAYLOAD_SIZE 32
+#endif // SERIAL_PIPELINE_PAYLOAD_SIZE
+
+#ifndef SERIAL_PIPELINE_TIMEOUT_US
+#    define SERIAL_PIPELINE_TIMEOUT_US 2000
+#endif // SERIAL_PIPELINE_TIMEOUT_US
+
+#ifndef SERIAL_PIPELINE_RETRIES
+#    define SERIAL_PIPELINE_RETRIES 3
+#endif // SERIAL_PIPELINE_RETRIES
+
+#define SERIAL_PIPELINE_SOF 0xA5
+#define SERIAL_PIPELINE_ACK 0x06
+#define SERIAL_PIPELINE_NAK 0x15
+// Set on the kind of the first frame after the master has given up on the frames before it
+#define SERIAL_PIPELINE_RESYNC 0x80
+
+#define SERIAL_PIPELINE_HEADER_SIZE 4
+#define SERIAL_PIPELINE_FRAME_SIZE (SERIAL_PIPELINE_HEADER_SIZE + UINT8_MAX + 1)
+
+/**
+ * The link the pipeline runs over.
+ */
+typedef struct serial_pipeline_io_t {
+    /**
+     * Queues bytes for sending, without waiting for them to go out.
+     */
+    bool (*send)(const uint8_t *data, size_t size);
+    /**
+     * Takes up to size bytes that have already been received, without waiting.
+     *
+     * @return the number of bytes taken
+     */
+    size_t (*receive)(uint8_t *data, size_t size);
+    /**
+     * Called while the master has nothing to do but wait for the slave.
+     */
+    void (*idle)(void);
+    /**
+     * The current time in microseconds.
+     */
+    uint32_t (*now_us)(void);
+} serial_pipeline_io_t;
+
+/**
+ * Runs a transaction on the slave.
+ *
+ * @param id[in] the transaction
+ * @param request[in] the data sent by the master
+ * @param request_length[in] the number of bytes sent by the master
+ * @param response[out] the data to send back, up to UINT8_MAX bytes
+ * @param response_length[out] the number of bytes to send back
+ * @param repeated[in] whether the transaction has already been run, and only the response was lost
+ * @return false if the transaction is not known, which is answered with a NAK
+ */
+typedef bool (*serial_pipeline_handler_t)(uint8_t id, const uint8_t *request, uint8_t request_length, uint8_t *response, uint8_t *response_length, bool repeated);
+
+typedef struct serial_pipeline_slot_t {
+    uint8_t        seq;
+    uint8_t        kind;
+    uint8_t        length;
+    const uint8_t *request;
+    uint8_t       *response;
+    uint8_t        response_length;
+    uint8_t        copy[SERIAL_PIPELINE_PAYLOAD_SIZE];
+} serial_pipeline_slot_t;
+
+typedef struct serial_pipeline_t {
+    const serial_pipeline_io_t *io;
+    serial_pipeline_handler_t   handler;
+    uint8_t                     rx_frame[SERIAL_PIPELINE_FRAME_SIZE];
+    uint16_t                    rx_length;
+    uint32_t                    rx_at;
+    uint8_t                     tx_frame[SERIAL_PIPELINE_FRAME_SIZE];
+
+    // Master: the unacknowledged frames, oldest first
+    serial_pipeline_slot_t slots[SERIAL_PIPELINE_WINDOW];
+    uint8_t                oldest;
+    uint8_t                count;
+    uint8_t                window;
+    uint8_t                next_seq;
+    uint8_t                attempts;
+    uint32_t               sent_at;
+    bool                   resync;
+    bool                   failed;
+
+    // Slave: the next frame to apply, and the last resync applied
+    uint8_t expected_seq;
+    bool    synced;
+    bool    nak_sent;
+    uint8_t resync_seq;
+    bool    resync_repeatable;
+
+    uint32_t retransmissions;
+} serial_pipeline_t;
+
+/**
+ * Starts the master side of the pipeline.
+ *
+ * @param pipeline[out] the pipeline
+ * @param io[in] the link to the slave
+ */
+void serial_pipeline_init_master(serial_pipeline_t *pipeline, const serial_pipeline_io_t *io);
+
+/**
+ * Starts the slave side of the pipeline.
+ *
+ * @param pipeline[out] the pipeline
+ * @param io[in] the link to the master
+ * @param handler[in] runs each transaction
+ */
+void serial_pipeline_init_slave(serial_pipeline_t *pipeline, const serial_pipeline_io_t *io, serial_pipeline_handler_t handler);
+
+/**
+ * Starts a transaction from the master. A write of no more than SERIAL_PIPELINE_PAYLOAD_SIZE bytes
+ * returns as soon as it has been queued. Anything else returns once it has been answered, and the
+ * request buffer has to stay valid until then.
+ *
+ * @param pipeline[in,out] the master pipeline
+ * @param id[in] the transaction
+ * @param request[in] the data to send
+ * @param request_length[in] the number of bytes to send
+ * @param response[out] where to put the response
+ * @param response_length[in] the number of bytes expected back, 0 for a write
+ * @return false if the link has failed, which may also be from an earlier write
+ */
+bool serial_pipeline_transaction(serial_pipeline_t *pipeline, uint8_t id, const uint8_t *request, uint8_t request_length, uint8_t *response, uint8_t response_length);
+
+/**
+ * Waits for every transaction the master has started to be acknowledged.
+ *
+ * @return false if the link has failed
+ */
+bool serial_pipeline_flush(serial_pipeline_t *pipeline);
+
+/**
+ * Handles whatever has been received, and retransmits anything the slave has not acknowledged in time.
+ */
+void serial_pipeline_poll(serial_pipeline_t *pipeline);
+
+/**
+ * Handles received bytes.
+ */
+void serial_pipeline_receive(serial_pipeline_t *pipeline, const uint8_t *data, size_t size);
@@ -0,0 +1,29 @@
+split_transaction_batch_SRC := \
+    $(QUANTUM_PATH)/split_common/tests/transaction_batch_tests.cpp \
+    $(QUANTUM_PATH)/split_common/transaction_batch.c \
+    $(QUANTUM_PATH)/crc.c
+split_transaction_batch_INC := \
+    $(QUANTUM_PATH)/split_common
+
+split_serial_pipeline_SRC := \
+    $(QUANTUM_PATH)/split_common/tests/serial_pipeline_tests.cpp \
+    $(QUANTUM_PATH)/split_common/serial_pipeline.c \
+    $(QUANTUM_PATH)/crc.c
+split_serial_pipeline_INC := \
+    $(QUANTUM_PATH)/split_common
+
+split_transactions_DEFS := \
+    -DSPLIT_KEYBOARD -DMATRIX_ROWS=2 -DMATRIX_COLS=1 -DNO_DEBUG -DDISABLE_SYNC_TIMER \
+    -DENCODER_ENABLE -DENCODER_TESTS -DNUM_ENCODERS_LEFT=1 -DNUM_ENCODERS_RIGHT=1 \
+    -DRGBLIGHT_ENABLE -DRGBLIGHT_SPLIT -DSPLIT_TRANSPORT_BATCH
+split_transactions_SRC := \
+    platforms/timer.c \
+    platforms/test/timer.c \
+    $(QUANTUM_PATH)/split_common/tests/transactions_tests.cpp \
+    $(QUANTUM_PATH)/split_common/transactions.c \
+    $(QUANTUM_PATH)/split_common/transaction_batch.c \
+    $(QUANTUM_PATH)/encoder.c \
+    $(QUANTUM_PATH)/crc.c
+split_transactions_INC := \
+    $(QUANTUM_PATH)/rgblight \
+    $(QUANTUM_PATH)/split_common
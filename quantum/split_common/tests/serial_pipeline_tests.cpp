@@ -0,0 +1,463 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "serial_pipeline.h"
+}
+
+// Both halves run in the same process, joined by a simulated full-duplex USART at 460800 baud in
+// 8E2, so 12 bits a byte. Time only moves on while the master waits, or does other work.
+static const uint64_t BYTE_NS = 12 * UINT64_C(1000000000) / 460800;
+
+static uint64_t now_ns;
+
+class Wire {
+   public:
+    void reset() {
+        bytes.clear();
+        corrupt.clear();
+        free_at   = 0;
+        sent      = 0;
+        connected = true;
+    }
+
+    void send(const uint8_t *data, size_t size) {
+        for (size_t i = 0; i < size; ++i, ++sent) {
+            free_at = std::max(free_at, now_ns) + BYTE_NS;
+            if (connected) {
+                bytes.push_back({free_at, corrupt.count(sent) ? (uint8_t)(data[i] ^ 0x10) : data[i]});
+            }
+        }
+    }
+
+    size_t receive(uint8_t *data, size_t size) {
+        size_t received = 0;
+        while (received < size && !bytes.empty() && bytes.front().first <= now_ns) {
+            data[received++] = bytes.front().second;
+            bytes.pop_front();
+        }
+        return received;
+    }
+
+    bool next_arrival(uint64_t *at) const {
+        if (bytes.empty()) {
+            return false;
+        }
+        *at = bytes.front().first;
+        return true;
+    }
+
+    std::deque<std::pair<uint64_t, uint8_t>> bytes;
+    // Indexes of sent bytes to flip a bit in
+    std::set<size_t> corrupt;
+    uint64_t         free_at;
+    size_t           sent;
+    bool             connected;
+};
+
+static Wire              to_slave, to_master;
+static serial_pipeline_t master, slave;
+
+// The slave's transactions, in the same shape as the split transaction table
+struct Transaction {
+    uint8_t request_size;
+    uint8_t response_size;
+};
+
+enum { GET_MATRIX, PUT_LAYERS, PUT_MODS, PUT_RGB, EXCHANGE, TRANSACTION_COUNT };
+
+static const Transaction transactions[TRANSACTION_COUNT] = {
+    {0, 4},  // GET_MATRIX
+    {8, 0},  // PUT_LAYERS
+    {4, 0},  // PUT_MODS
+    {12, 0}, // PUT_RGB
+    {2, 2},  // EXCHANGE
+};
+
+static uint8_t  slave_memory[TRANSACTION_COUNT][16];
+static uint8_t  slave_reply[TRANSACTION_COUNT][16];
+static int      applied[TRANSACTION_COUNT];
+static uint64_t applied_at[TRANSACTION_COUNT];
+
+static bool slave_handler(uint8_t id, const uint8_t *request, uint8_t request_length, uint8_t *response, uint8_t *response_length, bool repeated) {
+    if (id >= TRANSACTION_COUNT || request_length != transactions[id].request_size) {
+        return false;
+    }
+    if (!repeated) {
+        memcpy(slave_memory[id], request, request_length);
+        applied[id]++;
+        applied_at[id] = now_ns;
+    }
+    memcpy(response, slave_reply[id], transactions[id].response_size);
+    *response_length = transactions[id].response_size;
+    return true;
+}
+
+static void advance_to(uint64_t at) {
+    uint64_t arrival;
+    while (to_slave.next_arrival(&arrival) && arrival <= at) {
+        now_ns = std::max(now_ns, arrival);
+        serial_pipeline_poll(&slave);
+    }
+    now_ns = std::max(now_ns, at);
+    serial_pipeline_poll(&slave);
+}
+
+static void master_idle(void) {
+    uint64_t next = now_ns + 100000, arrival;
+    if (to_slave.next_arrival(&arrival)) {
+        next = std::min(next, arrival);
+    }
+    if (to_master.next_arrival(&arrival)) {
+        next = std::min(next, arrival);
+    }
+    advance_to(next);
+}
+
+static uint32_t sim_now_us(void) {
+    return (uint32_t)(now_ns / 1000);
+}
+
+static bool master_send(const uint8_t *data, size_t size) {
+    to_slave.send(data, size);
+    return true;
+}
+
+static size_t master_receive(uint8_t *data, size_t size) {
+    return to_master.receive(data, size);
+}
+
+static bool slave_send(const uint8_t *data, size_t size) {
+    to_master.send(data, size);
+    return true;
+}
+
+static size_t slave_receive(uint8_t *data, size_t size) {
+    return to_slave.receive(data, size);
+}
+
+static void slave_idle(void) {}
+
+static const serial_pipeline_io_t master_io = {master_send, master_receive, master_idle, sim_now_us};
+static const serial_pipeline_io_t slave_io  = {slave_send, slave_receive, slave_idle, sim_now_us};
+
+class SerialPipeline : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        now_ns = 0;
+        to_slave.reset();
+        to_master.reset();
+        memset(slave_memory, 0, sizeof(slave_memory));
+        memset(slave_reply, 0, sizeof(slave_reply));
+        memset(applied, 0, sizeof(applied));
+        serial_pipeline_init_master(&master, &master_io);
+        serial_pipeline_init_slave(&slave, &slave_io, slave_handler);
+    }
+
+    bool put(uint8_t id, uint8_t fill) {
+        uint8_t request[16];
+        memset(request, fill, sizeof(request));
+        return serial_pipeline_transaction(&master, id, request, transactions[id].request_size, NULL, 0);
+    }
+
+    bool get(uint8_t id, uint8_t *response) {
+        uint8_t request[16] = {0};
+        return serial_pipeline_transaction(&master, id, request, transactions[id].request_size, response, transactions[id].response_size);
+    }
+
+    void expect_slave_memory(uint8_t id, uint8_t fill) {
+        for (uint8_t i = 0; i < transactions[id].request_size; ++i) {
+            EXPECT_EQ(slave_memory[id][i], fill) << "transaction " << (int)id << " byte " << (int)i;
+        }
+    }
+};
+
+TEST_F(SerialPipeline, Writes_AppliedInOrder) {
+    EXPECT_TRUE(put(PUT_LAYERS, 1));
+    EXPECT_TRUE(put(PUT_MODS, 2));
+    EXPECT_TRUE(put(PUT_LAYERS, 3));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+
+    expect_slave_memory(PUT_LAYERS, 3);
+    expect_slave_memory(PUT_MODS, 2);
+    EXPECT_EQ(applied[PUT_LAYERS], 2);
+    EXPECT_EQ(applied[PUT_MODS], 1);
+    EXPECT_LT(applied_at[PUT_MODS], applied_at[PUT_LAYERS]);
+}
+
+TEST_F(SerialPipeline, Read_ReturnsTheResponse) {
+    uint8_t response[4] = {0};
+    memset(slave_reply[GET_MATRIX], 0x5A, sizeof(response));
+
+    EXPECT_TRUE(get(GET_MATRIX, response));
+    EXPECT_EQ(response[0], 0x5A);
+    EXPECT_EQ(response[3], 0x5A);
+}
+
+TEST_F(SerialPipeline, Writes_DoNotWaitForTheSlave) {
+    for (uint8_t i = 0; i < SERIAL_PIPELINE_WINDOW; ++i) {
+        EXPECT_TRUE(put(PUT_MODS, i));
+    }
+    EXPECT_EQ(now_ns, 0u);
+    EXPECT_EQ(applied[PUT_MODS], 0);
+
+    // Only once the window is full does the master have to wait
+    EXPECT_TRUE(put(PUT_MODS, 0xFF));
+    EXPECT_GT(now_ns, 0u);
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    EXPECT_EQ(applied[PUT_MODS], SERIAL_PIPELINE_WINDOW + 1);
+    expect_slave_memory(PUT_MODS, 0xFF);
+}
+
+TEST_F(SerialPipeline, Read_WaitsForTheWritesBeforeIt) {
+    uint8_t response[4];
+
+    EXPECT_TRUE(put(PUT_LAYERS, 7));
+    EXPECT_TRUE(get(GET_MATRIX, response));
+    EXPECT_EQ(master.count, 0);
+    expect_slave_memory(PUT_LAYERS, 7);
+}
+
+TEST_F(SerialPipeline, CorruptedRequest_SentAgainAndAppliedOnce) {
+    // The payload of the second frame
+    to_slave.corrupt.insert(9 + 5);
+
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_TRUE(put(PUT_MODS, 2));
+    EXPECT_TRUE(put(PUT_MODS, 3));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+
+    expect_slave_memory(PUT_MODS, 3);
+    EXPECT_EQ(applied[PUT_MODS], 3);
+    EXPECT_GT(master.retransmissions, 0u);
+}
+
+TEST_F(SerialPipeline, CorruptedStartOfFrame_SentAgain) {
+    to_slave.corrupt.insert(0);
+
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_TRUE(put(PUT_LAYERS, 2));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+
+    expect_slave_memory(PUT_MODS, 1);
+    expect_slave_memory(PUT_LAYERS, 2);
+    EXPECT_EQ(applied[PUT_MODS], 1);
+    EXPECT_EQ(applied[PUT_LAYERS], 1);
+}
+
+TEST_F(SerialPipeline, CorruptedResponse_NotAppliedTwice) {
+    uint8_t response[2] = {0};
+    slave_reply[EXCHANGE][0] = 0x12;
+    slave_reply[EXCHANGE][1] = 0x34;
+    // The response payload of the acknowledgement
+    to_master.corrupt.insert(4);
+
+    EXPECT_TRUE(get(EXCHANGE, response));
+    EXPECT_EQ(response[0], 0x12);
+    EXPECT_EQ(response[1], 0x34);
+    EXPECT_EQ(applied[EXCHANGE], 1);
+    EXPECT_EQ(master.retransmissions, 1u);
+}
+
+TEST_F(SerialPipeline, SlaveGone_FailsThenStartsAgain) {
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    to_slave.connected = false;
+
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_FALSE(serial_pipeline_flush(&master));
+    EXPECT_EQ(master.count, 0);
+
+    // The slave takes the next frame as the start of a new sequence
+    to_slave.connected = true;
+    EXPECT_TRUE(put(PUT_MODS, 2));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    expect_slave_memory(PUT_MODS, 2);
+}
+
+TEST_F(SerialPipeline, SlaveRestarted_MasterStartsAgain) {
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+
+    // Frames from before the restart are never applied, the master gives up on them and starts again
+    serial_pipeline_init_slave(&slave, &slave_io, slave_handler);
+    EXPECT_TRUE(put(PUT_MODS, 2));
+    EXPECT_FALSE(serial_pipeline_flush(&master));
+    expect_slave_memory(PUT_MODS, 1);
+
+    EXPECT_TRUE(put(PUT_MODS, 3));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    expect_slave_memory(PUT_MODS, 3);
+    EXPECT_EQ(applied[PUT_MODS], 2);
+}
+
+TEST_F(SerialPipeline, CorruptedLength_RestOfFrameDropped) {
+    // Makes the slave wait for far more than was sent
+    to_slave.corrupt.insert(3);
+
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    expect_slave_memory(PUT_MODS, 1);
+    EXPECT_EQ(master.retransmissions, 1u);
+}
+
+TEST_F(SerialPipeline, MasterRestarted_NewSequenceApplied) {
+    // Far enough for the slave to expect a frame just past the restarted master's first, with two in flight
+    for (int i = 0; i < 256 + 2; ++i) {
+        EXPECT_TRUE(put(PUT_MODS, i));
+    }
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_TRUE(put(PUT_MODS, 2));
+
+    serial_pipeline_init_master(&master, &master_io);
+    EXPECT_TRUE(put(PUT_LAYERS, 1));
+    EXPECT_TRUE(put(PUT_LAYERS, 2));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    expect_slave_memory(PUT_LAYERS, 2);
+    EXPECT_EQ(applied[PUT_LAYERS], 2);
+}
+
+TEST_F(SerialPipeline, ResyncSentAgain_AppliedOnce) {
+    to_slave.connected = false;
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    EXPECT_FALSE(serial_pipeline_flush(&master));
+    to_slave.connected = true;
+    master.retransmissions = 0;
+    // The acknowledgements of the first two frames after giving up, so both are sent again
+    to_master.corrupt.insert(to_master.sent + 4);
+    to_master.corrupt.insert(to_master.sent + 9);
+
+    EXPECT_TRUE(put(PUT_MODS, 2));
+    EXPECT_TRUE(put(PUT_LAYERS, 3));
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    EXPECT_GT(master.retransmissions, 0u);
+    EXPECT_EQ(applied[PUT_MODS], 1);
+    EXPECT_EQ(applied[PUT_LAYERS], 1);
+}
+
+TEST_F(SerialPipeline, PartialResponse_KeptOverALongScan) {
+    EXPECT_TRUE(put(PUT_MODS, 1));
+    // Catch the master part way through the acknowledgement
+    while (master.rx_length == 0 && master.count) {
+        advance_to(now_ns + BYTE_NS);
+        serial_pipeline_poll(&master);
+    }
+    ASSERT_GT(master.rx_length, 0);
+
+    advance_to(now_ns + SERIAL_PIPELINE_TIMEOUT_US * 3 / 4 * 1000);
+    EXPECT_TRUE(serial_pipeline_flush(&master));
+    EXPECT_EQ(master.retransmissions, 0u);
+}
+
+////////////////////////////////////////////////////
+// Benchmark
+
+struct SyncStats {
+    uint64_t blocked_ns  = 0;
+    uint64_t latency_ns  = 0;
+    uint64_t elapsed_ns  = 0;
+    uint64_t bytes       = 0;
+    uint32_t syncs       = 0;
+    uint32_t failures    = 0;
+    uint32_t retransmits = 0;
+};
+
+class SerialPipelineBenchmark : public SerialPipeline {
+   protected:
+    // One split sync as transactions_master() does it, read the slave's matrix then push the master's state
+    SyncStats run(uint8_t window, uint32_t syncs, uint64_t scan_ns, size_t corrupt_every) {
+        master.window = window;
+        for (size_t i = corrupt_every; corrupt_every && i < 100000; i += corrupt_every) {
+            to_slave.corrupt.insert(i);
+            to_master.corrupt.insert(i + corrupt_every / 2);
+        }
+
+        SyncStats stats;
+        uint64_t  start = now_ns;
+        uint64_t  previous = 0;
+        uint8_t   response[4];
+        for (uint32_t sync = 0; sync < syncs; ++sync) {
+            uint64_t begin = now_ns;
+            bool     okay  = get(GET_MATRIX, response);
+            // The read went after the previous sync's writes, which have all landed by now
+            if (sync) {
+                stats.latency_ns += applied_at[PUT_RGB] - previous;
+            }
+            previous = begin;
+            okay &= put(PUT_LAYERS, sync);
+            okay &= put(PUT_MODS, sync);
+            okay &= put(PUT_RGB, sync);
+            stats.blocked_ns += now_ns - begin;
+            stats.failures += !okay;
+
+            // The rest of the scan, while the writes go out
+            advance_to(now_ns + scan_ns);
+            serial_pipeline_poll(&master);
+            stats.bytes += transactions[GET_MATRIX].response_size + transactions[PUT_LAYERS].request_size + transactions[PUT_MODS].request_size + transactions[PUT_RGB].request_size;
+        }
+        stats.failures += !serial_pipeline_flush(&master);
+        stats.latency_ns += applied_at[PUT_RGB] - previous;
+        stats.elapsed_ns  = now_ns - start;
+        stats.syncs       = syncs;
+        stats.retransmits = master.retransmissions;
+        return stats;
+    }
+
+    static void report(const char *name, const SyncStats &stats) {
+        std::cout << "  " << std::left << std::setw(24) << name << std::right                                   //
+                  << " blocked/sync=" << std::setw(6) << stats.blocked_ns / stats.syncs / 1000 << "us"          //
+                  << "  latency=" << std::setw(6) << stats.latency_ns / stats.syncs / 1000 << "us"              //
+                  << "  throughput=" << std::setw(6) << stats.bytes * 1000000 / stats.elapsed_ns << "kB/s"      //
+                  << "  syncs/s=" << std::setw(6) << (uint64_t)stats.syncs * 1000000000 / stats.elapsed_ns      //
+                  << "  retransmits=" << stats.retransmits << "  failures=" << stats.failures << std::endl;
+    }
+};
+
+TEST_F(SerialPipelineBenchmark, BackToBack) {
+    SyncStats stop_and_wait = run(1, 1000, 0, 0);
+    SetUp();
+    SyncStats pipelined = run(SERIAL_PIPELINE_WINDOW, 1000, 0, 0);
+
+    report("stop-and-wait", stop_and_wait);
+    report("pipelined", pipelined);
+    EXPECT_EQ(stop_and_wait.failures, 0u);
+    EXPECT_EQ(pipelined.failures, 0u);
+    EXPECT_GT(pipelined.bytes * stop_and_wait.elapsed_ns, stop_and_wait.bytes * pipelined.elapsed_ns);
+    EXPECT_LT(pipelined.blocked_ns, stop_and_wait.blocked_ns);
+}
+
+TEST_F(SerialPipelineBenchmark, WithScanWork) {
+    SyncStats stop_and_wait = run(1, 1000, 250000, 0);
+    SetUp();
+    SyncStats pipelined = run(SERIAL_PIPELINE_WINDOW, 1000, 250000, 0);
+
+    report("stop-and-wait, 250us scan", stop_and_wait);
+    report("pipelined, 250us scan", pipelined);
+    EXPECT_LT(pipelined.blocked_ns, stop_and_wait.blocked_ns);
+    EXPECT_LT(pipelined.elapsed_ns, stop_and_wait.elapsed_ns);
+}
+
+TEST_F(SerialPipelineBenchmark, WithBitErrors) {
+    SyncStats stop_and_wait = run(1, 1000, 250000, 997);
+    uint8_t   expected[16];
+    memset(expected, 999 & 0xFF, sizeof(expected));
+    EXPECT_EQ(memcmp(slave_memory[PUT_RGB], expected, transactions[PUT_RGB].request_size), 0);
+    SetUp();
+    SyncStats pipelined = run(SERIAL_PIPELINE_WINDOW, 1000, 250000, 997);
+    EXPECT_EQ(memcmp(slave_memory[PUT_RGB], expected, transactions[PUT_RGB].request_size), 0);
+
+    report("stop-and-wait, 0.1% BER", stop_and_wait);
+    report("pipelined, 0.1% BER", pipelined);
+    EXPECT_GT(pipelined.retransmits, 0u);
+}
@@ -0,0 +1 @@
+TEST_LIST += split_transaction_batch split_serial_pipeline split_transactions
@@ -0,0 +1,135 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transaction_batch.h"
+}
+
+#define FRAME_SIZE 32
+
+// Two transaction buffers on the target, as the slave's shared memory would hold them
+static uint8_t target[2][8];
+
+static void apply_to_target(int8_t id, uint8_t offset, const uint8_t *data, uint8_t length) {
+    memcpy(&target[id][offset], data, length);
+}
+
+class SplitTransactionBatch : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(target, 0, sizeof(target));
+        memset(frame, 0xAA, sizeof(frame));
+        split_batch_frame_init(frame);
+    }
+
+    uint8_t frame[FRAME_SIZE];
+};
+
+TEST_F(SplitTransactionBatch, Unchanged_NothingAdded) {
+    uint8_t acked[8]   = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t current[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    EXPECT_FALSE(split_batch_frame_add_delta(frame, sizeof(frame), 0, current, acked, sizeof(current)));
+    EXPECT_TRUE(split_batch_frame_is_empty(frame));
+}
+
+TEST_F(SplitTransactionBatch, Changed_OnlyTheChangedSpanIsSent) {
+    uint8_t acked[8]   = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t current[8] = {1, 2, 9, 4, 9, 6, 7, 8};
+    memcpy(target[1], acked, sizeof(acked));
+
+    EXPECT_TRUE(split_batch_frame_add_delta(frame, sizeof(frame), 1, current, acked, sizeof(current)));
+    EXPECT_EQ(frame[0], SPLIT_BATCH_ENTRY_HEADER_SIZE + 3);
+    uint8_t checksum = split_batch_frame_seal(frame);
+
+    uint8_t received;
+    EXPECT_TRUE(split_batch_frame_apply(frame, sizeof(frame), apply_to_target, &received));
+    EXPECT_EQ(received, checksum);
+    EXPECT_EQ(memcmp(target[1], current, sizeof(current)), 0);
+}
+
+TEST_F(SplitTransactionBatch, NotAcked_WholeBufferIsSent) {
+    uint8_t current[8] = {0, 0, 3, 0, 0, 0, 0, 0};
+    memset(target[0], 0xFF, sizeof(target[0]));
+
+    EXPECT_TRUE(split_batch_frame_add_delta(frame, sizeof(frame), 0, current, NULL, sizeof(current)));
+    EXPECT_EQ(frame[0], SPLIT_BATCH_ENTRY_HEADER_SIZE + sizeof(current));
+    split_batch_frame_seal(frame);
+
+    uint8_t received;
+    EXPECT_TRUE(split_batch_frame_apply(frame, sizeof(frame), apply_to_target, &received));
+    EXPECT_EQ(memcmp(target[0], current, sizeof(current)), 0);
+}
+
+TEST_F(SplitTransactionBatch, SeveralTransactions_AppliedFromOneFrame) {
+    uint8_t current[2][8] = {{1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 2}};
+
+    EXPECT_TRUE(split_batch_frame_add_delta(frame, sizeof(frame), 0, current[0], target[0], sizeof(current[0])));
+    EXPECT_TRUE(split_batch_frame_add_delta(frame, sizeof(frame), 1, current[1], target[1], sizeof(current[1])));
+    split_batch_frame_seal(frame);
+
+    uint8_t received;
+    EXPECT_TRUE(split_batch_frame_apply(frame, sizeof(frame), apply_to_target, &received));
+    EXPECT_EQ(memcmp(target, current, sizeof(current)), 0);
+}
+
+TEST_F(SplitTransactionBatch, Full_LeftForTheNextFrame) {
+    uint8_t current[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // Each whole buffer takes 11 bytes, and the frame has room for 30 of them besides its length and checksum
+    EXPECT_TRUE(split_batch_frame_add_delta(frame, sizeof(frame), 0, current, NULL, sizeof(current)));
+    EXPECT_TRUE(split_batch_frame_add_delta(frame, sizeof(frame), 1, current, NULL, sizeof(current)));
+    uint8_t used = frame[0];
+    EXPECT_FALSE(split_batch_frame_add_delta(frame, sizeof(frame), 0, current, NULL, sizeof(current)));
+    EXPECT_EQ(frame[0], used);
+
+    // A smaller change still fits
+    uint8_t acked[8] = {1, 2, 3, 4, 5, 6, 7, 0};
+    EXPECT_TRUE(split_batch_frame_add_delta(frame, sizeof(frame), 0, current, acked, sizeof(current)));
+}
+
+TEST_F(SplitTransactionBatch, Corrupted_NothingApplied) {
+    uint8_t current[2][8] = {{1, 1, 1, 1, 1, 1, 1, 1}, {2, 2, 2, 2, 2, 2, 2, 2}};
+
+    split_batch_frame_add_delta(frame, sizeof(frame), 0, current[0], target[0], sizeof(current[0]));
+    split_batch_frame_add_delta(frame, sizeof(frame), 1, current[1], target[1], sizeof(current[1]));
+    uint8_t checksum = split_batch_frame_seal(frame);
+    frame[frame[0]] ^= 0x01;
+
+    uint8_t received;
+    EXPECT_FALSE(split_batch_frame_apply(frame, sizeof(frame), apply_to_target, &received));
+    EXPECT_EQ(received, checksum);
+    uint8_t zeroes[2][8] = {};
+    EXPECT_EQ(memcmp(target, zeroes, sizeof(zeroes)), 0);
+}
+
+TEST_F(SplitTransactionBatch, Truncated_NothingApplied) {
+    uint8_t current[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+
+    split_batch_frame_add_delta(frame, sizeof(frame), 0, current, NULL, sizeof(current));
+    split_batch_frame_seal(frame);
+    frame[0] = sizeof(frame);
+
+    uint8_t received;
+    EXPECT_FALSE(split_batch_frame_apply(frame, sizeof(frame), apply_to_target, &received));
+    uint8_t zeroes[8] = {};
+    EXPECT_EQ(memcmp(target[0], zeroes, sizeof(zeroes)), 0);
+}
+
+TEST_F(SplitTransactionBatch, MalformedEntry_NothingApplied) {
+    uint8_t current[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+
+    split_batch_frame_add_delta(frame, sizeof(frame), 0, current, NULL, sizeof(current));
+    // Claims more data than the frame holds, with a checksum that matches
+    frame[3] = sizeof(current) + 1;
+    split_batch_frame_seal(frame);
+
+    uint8_t received;
+    EXPECT_FALSE(split_batch_frame_apply(frame, sizeof(frame), apply_to_target, &received));
+    uint8_t zeroes[8] = {};
+    EXPECT_EQ(memcmp(target[0], zeroes, sizeof(zeroes)), 0);
+}
@@ -0,0 +1,202 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "crc.h"
+#include "encoder.h"
+#include "rgblight.h"
+#include "transactions.h"
+#include "transaction_batch.h"
+}
+
+// The master's shared memory is the one the transactions work on, the slave's is scripted below
+static split_shared_memory_t master_memory;
+static split_shared_memory_t slave_memory;
+extern "C" split_shared_memory_t *const split_shmem = &master_memory;
+
+static bool    drain_pending;
+static uint8_t rgblight_updates;
+
+static rgblight_syncinfo_t rgblight_state;
+
+static uint8_t *slave_buffer(uint16_t offset) {
+    return ((uint8_t *)&slave_memory) + offset;
+}
+
+static void slave_publish_encoders(void) {
+    slave_memory.encoders.checksum = crc8(&slave_memory.encoders.events, sizeof(slave_memory.encoders.events));
+}
+
+static void slave_queue_encoder_event(uint8_t index, bool clockwise) {
+    encoder_queue_event_advanced(&slave_memory.encoders.events, index, clockwise);
+    slave_publish_encoders();
+}
+
+// The slave only gets round to the drain in its next encoder_task(), so until this is called it is still reporting the old queue
+static void slave_apply_drain(void) {
+    encoder_events_t *events = &slave_memory.encoders.events;
+    while (events->dequeued != slave_memory.encoders.drained && !encoder_queue_empty_advanced(events)) {
+        events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+        events->dequeued++;
+    }
+    drain_pending = false;
+    slave_publish_encoders();
+}
+
+static void slave_apply_batch_entry(int8_t id, uint8_t offset, const uint8_t *data, uint8_t length) {
+    memcpy(slave_buffer(split_transaction_table[id].initiator2target_offset) + offset, data, length);
+}
+
+static void slave_handle(int8_t id) {
+    if (id == CMD_ENCODER_DRAIN) {
+        drain_pending = true;
+    } else if (id == CMD_BATCH_SYNC) {
+        uint8_t checksum;
+        bool    okay           = split_batch_frame_apply(slave_memory.batch.frame, sizeof(slave_memory.batch.frame), slave_apply_batch_entry, &checksum);
+        slave_memory.batch.ack = okay ? checksum : (uint8_t)~checksum;
+        // As rgblight_handlers_slave() does
+        if (slave_memory.rgblight_sync.status.change_flags != 0) {
+            slave_memory.rgblight_sync.status.change_flags = 0;
+            rgblight_updates++;
+        }
+    }
+}
+
+extern "C" {
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        memcpy(slave_buffer(trans->initiator2target_offset), initiator2target_buf, len);
+    }
+
+    slave_handle(id);
+
+    if (target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(split_trans_target2initiator_buffer(trans), slave_buffer(trans->target2initiator_offset), len);
+        memcpy(target2initiator_buf, slave_buffer(trans->target2initiator_offset), len);
+    }
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+void encoder_driver_init(void) {}
+void encoder_driver_task(void) {}
+
+void split_shared_memory_lock(void) {}
+void split_shared_memory_unlock(void) {}
+
+void rgblight_get_syncinfo(rgblight_syncinfo_t *syncinfo) {
+    memcpy(syncinfo, &rgblight_state, sizeof(rgblight_state));
+}
+
+void rgblight_clear_change_flags(void) {
+    rgblight_state.status.change_flags = 0;
+}
+
+void rgblight_update_sync(rgblight_syncinfo_t *syncinfo, bool write_to_eeprom) {}
+}
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(&master_memory, 0, sizeof(master_memory));
+        memset(&slave_memory, 0, sizeof(slave_memory));
+        memset(&rgblight_state, 0, sizeof(rgblight_state));
+        drain_pending    = false;
+        rgblight_updates = 0;
+        encoder_init();
+        slave_memory.smatrix.checksum = crc8(slave_memory.smatrix.matrix, sizeof(slave_memory.smatrix.matrix));
+        slave_publish_encoders();
+    }
+
+    bool scan(void) {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    std::vector<uint8_t> take_master_events(void) {
+        std::vector<uint8_t> taken;
+        uint8_t              index;
+        bool                 clockwise;
+        while (encoder_dequeue_event(&index, &clockwise)) {
+            taken.push_back(index);
+        }
+        return taken;
+    }
+
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+};
+
+TEST_F(SplitTransactions, Encoders_PartlyTakenThenStaleRead_EachEventOnce) {
+    // Leave room for two of the slave's three events on the master
+    encoder_queue_event(9, true);
+    slave_queue_encoder_event(0, true);
+    slave_queue_encoder_event(1, true);
+    slave_queue_encoder_event(2, true);
+
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(drain_pending);
+    EXPECT_EQ(take_master_events(), (std::vector<uint8_t>{9, 0, 1}));
+
+    // The slave has not drained yet, so this reads back all three again
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(take_master_events().empty());
+
+    slave_apply_drain();
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(take_master_events(), (std::vector<uint8_t>{2}));
+
+    slave_apply_drain();
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(take_master_events().empty());
+}
+
+TEST_F(SplitTransactions, Encoders_MasterFull_TakenOnceThereIsRoom) {
+    encoder_queue_event(7, true);
+    encoder_queue_event(8, true);
+    encoder_queue_event(9, true);
+    slave_queue_encoder_event(0, true);
+
+    EXPECT_TRUE(scan());
+    EXPECT_FALSE(drain_pending);
+    EXPECT_EQ(take_master_events(), (std::vector<uint8_t>{7, 8, 9}));
+
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(drain_pending);
+    EXPECT_EQ(take_master_events(), (std::vector<uint8_t>{0}));
+}
+
+TEST_F(SplitTransactions, Rgblight_ChangeFlagsAreSentOnce) {
+    rgblight_state.config.mode         = 2;
+    rgblight_state.status.change_flags = RGBLIGHT_STATUS_CHANGE_MODE;
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(rgblight_updates, 1);
+    EXPECT_EQ(slave_memory.rgblight_sync.config.mode, 2);
+
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(rgblight_updates, 1);
+
+    rgblight_state.config.mode         = 3;
+    rgblight_state.status.change_flags = RGBLIGHT_STATUS_CHANGE_MODE;
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(rgblight_updates, 2);
+    EXPECT_EQ(slave_memory.rgblight_sync.config.mode, 3);
+}
@@ -0,0 +1,80 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "crc.h"
+#include "transaction_batch.h"
+
+void split_batch_frame_init(uint8_t *frame) {
+    frame[0] = 0;
+}
+
+bool split_batch_frame_add_delta(uint8_t *frame, uint8_t frame_size, int8_t id, const uint8_t *current, const uint8_t *acked, uint8_t length) {
+    uint8_t first = 0;
+    uint8_t last  = length;
+    if (acked) {
+        while (first < length && current[first] == acked[first]) {
+            first++;
+        }
+        if (first == length) {
+            return false;
+        }
+        while (current[last - 1] == acked[last - 1]) {
+            last--;
+        }
+    }
+
+    uint8_t  span = last - first;
+    uint16_t used = 1 + frame[0];
+    if (used + SPLIT_BATCH_ENTRY_HEADER_SIZE + span + 1 > frame_size) {
+        return false;
+    }
+
+    uint8_t *entry = &frame[used];
+    entry[0]       = (uint8_t)id;
+    entry[1]       = first;
+    entry[2]       = span;
+    memcpy(&entry[SPLIT_BATCH_ENTRY_HEADER_SIZE], &current[first], span);
+    frame[0] += SPLIT_BATCH_ENTRY_HEADER_SIZE + span;
+    return true;
+}
+
+uint8_t split_batch_frame_seal(uint8_t *frame) {
+    uint8_t used = 1 + frame[0];
+    frame[used]  = crc8(frame, used);
+    return frame[used];
+}
+
+bool split_batch_frame_is_empty(const uint8_t *frame) {
+    return frame[0] == 0;
+}
+
+bool split_batch_frame_apply(const uint8_t *frame, uint8_t frame_size, split_batch_apply_t apply, uint8_t *checksum) {
+    uint16_t used = 1 + frame[0];
+    if (used >= frame_size) {
+        *checksum = frame[frame_size - 1];
+        return false;
+    }
+    *checksum = frame[used];
+    if (crc8(frame, used) != *checksum) {
+        return false;
+    }
+
+    // Check that every entry is whole before applying any of them
+    uint16_t pos = 1;
+    while (pos < used) {
+        if (pos + SPLIT_BATCH_ENTRY_HEADER_SIZE > used || pos + SPLIT_BATCH_ENTRY_HEADER_SIZE + frame[pos + 2] > used) {
+            return false;
+        }
+        pos += SPLIT_BATCH_ENTRY_HEADER_SIZE + frame[pos + 2];
+    }
+
+    pos = 1;
+    while (pos < used) {
+        const uint8_t *entry = &frame[pos];
+        apply((int8_t)entry[0], entry[1], &entry[SPLIT_BATCH_ENTRY_HEADER_SIZE], entry[2]);
+        pos += SPLIT_BATCH_ENTRY_HEADER_SIZE + entry[2];
+    }
+    return true;
+}
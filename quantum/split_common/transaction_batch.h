@@ -0,0 +1,77 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A batch frame carries the changes to several initiator-to-target transactions at once, so that
+// they cost a single round-trip. It is laid out as:
+//
+//     [entries length] [entry]... [crc8 of everything before it]
+//
+// and each entry as:
+//
+//     [transaction id] [offset into its buffer] [length] [data]...
+//
+// The entries are the span of a buffer from its first to its last byte that differ from what the
+// target was last acknowledged to hold, or the whole buffer if that is not known.
+
+#define SPLIT_BATCH_FRAME_OVERHEAD 2
+#define SPLIT_BATCH_ENTRY_HEADER_SIZE 3
+
+/**
+ * Applies one entry of a batch frame on the target.
+ *
+ * @param id[in] the transaction the data belongs to
+ * @param offset[in] the offset of the data into that transaction's buffer
+ * @param data[in] the data
+ * @param length[in] the number of bytes of data
+ */
+typedef void (*split_batch_apply_t)(int8_t id, uint8_t offset, const uint8_t *data, uint8_t length);
+
+/**
+ * Starts an empty batch frame.
+ *
+ * @param frame[out] the frame buffer
+ */
+void split_batch_frame_init(uint8_t *frame);
+
+/**
+ * Adds the changes to a transaction buffer to the frame.
+ *
+ * @param frame[in,out] the frame buffer
+ * @param frame_size[in] the size of the frame buffer
+ * @param id[in] the transaction
+ * @param current[in] the buffer as the target should hold it
+ * @param acked[in] the buffer as the target was last acknowledged to hold it, or NULL to send all of it
+ * @param length[in] the size of the buffer
+ * @return true if an entry was added, false if nothing changed or it did not fit
+ */
+bool split_batch_frame_add_delta(uint8_t *frame, uint8_t frame_size, int8_t id, const uint8_t *current, const uint8_t *acked, uint8_t length);
+
+/**
+ * Finishes the frame by appending its checksum.
+ *
+ * @param frame[in,out] the frame buffer
+ * @return the checksum, which the target echoes back once it has applied the frame
+ */
+uint8_t split_batch_frame_seal(uint8_t *frame);
+
+/**
+ * Whether the frame has any entries to send.
+ */
+bool split_batch_frame_is_empty(const uint8_t *frame);
+
+/**
+ * Checks the frame and applies each of its entries, in order. Nothing is applied from a frame that
+ * is truncated or fails its checksum.
+ *
+ * @param frame[in] the received frame buffer
+ * @param frame_size[in] the size of the frame buffer
+ * @param apply[in] called for each entry
+ * @param checksum[out] the checksum of the frame as received
+ * @return true if the frame was valid and applied
+ */
+bool split_batch_frame_apply(const uint8_t *frame, uint8_t frame_size, split_batch_apply_t apply, uint8_t *checksum);
@@ -64,6 +64,9 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_TRANSPORT_BATCH
+#    include "transaction_batch.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -81,6 +84,9 @@
     { 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), cb }
 #define trans_target2initiator_initializer(member) trans_target2initiator_initializer_cb(member, NULL)
 
+#define trans_bidirectional_initializer_cb(initiator_member, target_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator_member), offsetof(split_shared_memory_t, initiator_member), sizeof_member(split_shared_memory_t, target_member), offsetof(split_shared_memory_t, target_member), cb }
+
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
@@ -88,6 +94,13 @@
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+// Only staged in the shared memory here, the changes are sent together at the end of transactions_master()
+#    define transport_put(id, data, length) transport_stage(id, data, length)
+#else
+#    define transport_put(id, data, length) transport_write(id, data, length)
+#endif // SPLIT_TRANSPORT_BATCH
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -144,6 +157,15 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+inline static bool transport_stage(int8_t trans_id, const void *source, size_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[trans_id];
+    size_t                    len   = trans->initiator2target_buffer_size < length ? trans->initiator2target_buffer_size : length;
+    memcpy(split_trans_initiator2target_buffer(trans), source, len);
+    return true;
+}
+#endif // SPLIT_TRANSPORT_BATCH
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
@@ -162,7 +184,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+        okay &= transport_put(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -224,12 +246,14 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 #    define TRANSACTIONS_MASTER_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(master_matrix)
 #    define TRANSACTIONS_MASTER_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(master_matrix)
 #    define TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS [PUT_MASTER_MATRIX] = trans_initiator2target_initializer(mmatrix.matrix),
+#    define TRANSACTIONS_MASTER_MATRIX_BATCHED SPLIT_BATCH_BIT(PUT_MASTER_MATRIX) |
 
 #else // SPLIT_TRANSPORT_MIRROR
 
 #    define TRANSACTIONS_MASTER_MATRIX_MASTER()
 #    define TRANSACTIONS_MASTER_MATRIX_SLAVE()
 #    define TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
+#    define TRANSACTIONS_MASTER_MATRIX_BATCHED
 
 #endif // SPLIT_TRANSPORT_MIRROR
 
@@ -249,15 +273,20 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
             bool    actioned = false;
             uint8_t index;
             bool    clockwise;
-            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
+            // Events which don't fit are left on the slave, and read again once its queue has been drained
+            while (okay && !encoder_queue_full() && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
                 okay &= encoder_queue_event(index, clockwise);
                 actioned = true;
             }
 
             if (actioned) {
-                okay &= transport_exec(CMD_ENCODER_DRAIN);
+                okay &= transport_write(CMD_ENCODER_DRAIN, &split_shmem->encoders.events.dequeued, sizeof(split_shmem->encoders.events.dequeued));
+            }
+            // Once drained, the slave's checksum changes and the rest are read again; until then, a stale read
+            // still carries this checksum and is ignored. If nothing fitted, retry from this copy on the next pass.
+            if (actioned || encoder_queue_empty_advanced(&split_shmem->encoders.events)) {
+                last_checksum = split_shmem->encoders.checksum;
             }
-            last_checksum = split_shmem->encoders.checksum;
         }
     }
     return okay;
@@ -271,7 +300,7 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
-    encoder_signal_queue_drain();
+    encoder_signal_queue_drain(split_shmem->encoders.drained);
 }
 
 // clang-format off
@@ -280,7 +309,7 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 #    define TRANSACTIONS_ENCODERS_REGISTRATIONS \
     [GET_ENCODERS_CHECKSUM] = trans_target2initiator_initializer(encoders.checksum), \
     [GET_ENCODERS_DATA]     = trans_target2initiator_initializer(encoders.events), \
-    [CMD_ENCODER_DRAIN]     = trans_initiator2target_cb(encoder_handlers_slave_drain),
+    [CMD_ENCODER_DRAIN]     = trans_initiator2target_initializer_cb(encoders.drained, encoder_handlers_slave_drain),
 // clang-format on
 
 #else // ENCODER_ENABLE
@@ -357,6 +386,7 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS \
     [PUT_LAYER_STATE]         = trans_initiator2target_initializer(layers.layer_state), \
     [PUT_DEFAULT_LAYER_STATE] = trans_initiator2target_initializer(layers.default_layer_state),
+#    define TRANSACTIONS_LAYER_STATE_BATCHED SPLIT_BATCH_BIT(PUT_LAYER_STATE) | SPLIT_BATCH_BIT(PUT_DEFAULT_LAYER_STATE) |
 // clang-format on
 
 #else // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
@@ -364,6 +394,7 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #    define TRANSACTIONS_LAYER_STATE_MASTER()
 #    define TRANSACTIONS_LAYER_STATE_SLAVE()
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS
+#    define TRANSACTIONS_LAYER_STATE_BATCHED
 
 #endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
@@ -386,12 +417,14 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_LED_STATE_MASTER() TRANSACTION_HANDLER_MASTER(led_state)
 #    define TRANSACTIONS_LED_STATE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(led_state)
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS [PUT_LED_STATE] = trans_initiator2target_initializer(led_state),
+#    define TRANSACTIONS_LED_STATE_BATCHED SPLIT_BATCH_BIT(PUT_LED_STATE) |
 
 #else // SPLIT_LED_STATE_ENABLE
 
 #    define TRANSACTIONS_LED_STATE_MASTER()
 #    define TRANSACTIONS_LED_STATE_SLAVE()
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS
+#    define TRANSACTIONS_LED_STATE_BATCHED
 
 #endif // SPLIT_LED_STATE_ENABLE
 
@@ -427,7 +460,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transport_put(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
             last_update = timer_read32();
         }
@@ -453,12 +486,14 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #    define TRANSACTIONS_MODS_MASTER() TRANSACTION_HANDLER_MASTER(mods)
 #    define TRANSACTIONS_MODS_SLAVE() TRANSACTION_HANDLER_SLAVE(mods)
 #    define TRANSACTIONS_MODS_REGISTRATIONS [PUT_MODS] = trans_initiator2target_initializer(mods),
+#    define TRANSACTIONS_MODS_BATCHED SPLIT_BATCH_BIT(PUT_MODS) |
 
 #else // SPLIT_MODS_ENABLE
 
 #    define TRANSACTIONS_MODS_MASTER()
 #    define TRANSACTIONS_MODS_SLAVE()
 #    define TRANSACTIONS_MODS_REGISTRATIONS
+#    define TRANSACTIONS_MODS_BATCHED
 
 #endif // SPLIT_MODS_ENABLE
 
@@ -484,12 +519,14 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(backlight)
 #    define TRANSACTIONS_BACKLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(backlight)
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS [PUT_BACKLIGHT] = trans_initiator2target_initializer(backlight_level),
+#    define TRANSACTIONS_BACKLIGHT_BATCHED SPLIT_BATCH_BIT(PUT_BACKLIGHT) |
 
 #else // BACKLIGHT_ENABLE
 
 #    define TRANSACTIONS_BACKLIGHT_MASTER()
 #    define TRANSACTIONS_BACKLIGHT_SLAVE()
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS
+#    define TRANSACTIONS_BACKLIGHT_BATCHED
 
 #endif // BACKLIGHT_ENABLE
 
@@ -526,12 +563,14 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
+#    define TRANSACTIONS_RGBLIGHT_BATCHED SPLIT_BATCH_BIT(PUT_RGBLIGHT) |
 
 #else // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 #    define TRANSACTIONS_RGBLIGHT_MASTER()
 #    define TRANSACTIONS_RGBLIGHT_SLAVE()
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS
+#    define TRANSACTIONS_RGBLIGHT_BATCHED
 
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
@@ -560,12 +599,14 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
+#    define TRANSACTIONS_LED_MATRIX_BATCHED SPLIT_BATCH_BIT(PUT_LED_MATRIX) |
 
 #else // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
 #    define TRANSACTIONS_LED_MATRIX_MASTER()
 #    define TRANSACTIONS_LED_MATRIX_SLAVE()
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS
+#    define TRANSACTIONS_LED_MATRIX_BATCHED
 
 #endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
@@ -594,12 +635,14 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    define TRANSACTIONS_RGB_MATRIX_BATCHED SPLIT_BATCH_BIT(PUT_RGB_MATRIX) |
 
 #else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 #    define TRANSACTIONS_RGB_MATRIX_MASTER()
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE()
 #    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS
+#    define TRANSACTIONS_RGB_MATRIX_BATCHED
 
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
@@ -621,12 +664,14 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 #    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
+#    define TRANSACTIONS_WPM_BATCHED SPLIT_BATCH_BIT(PUT_WPM) |
 
 #else // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
 #    define TRANSACTIONS_WPM_MASTER()
 #    define TRANSACTIONS_WPM_SLAVE()
 #    define TRANSACTIONS_WPM_REGISTRATIONS
+#    define TRANSACTIONS_WPM_BATCHED
 
 #endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
@@ -656,12 +701,14 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
 #    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
+#    define TRANSACTIONS_OLED_BATCHED SPLIT_BATCH_BIT(PUT_OLED) |
 
 #else // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 #    define TRANSACTIONS_OLED_MASTER()
 #    define TRANSACTIONS_OLED_SLAVE()
 #    define TRANSACTIONS_OLED_REGISTRATIONS
+#    define TRANSACTIONS_OLED_BATCHED
 
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
@@ -691,12 +738,14 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
+#    define TRANSACTIONS_ST7565_BATCHED SPLIT_BATCH_BIT(PUT_ST7565) |
 
 #else // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 #    define TRANSACTIONS_ST7565_MASTER()
 #    define TRANSACTIONS_ST7565_SLAVE()
 #    define TRANSACTIONS_ST7565_REGISTRATIONS
+#    define TRANSACTIONS_ST7565_BATCHED
 
 #endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
@@ -776,12 +825,14 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
 #    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_BATCHED SPLIT_BATCH_BIT(PUT_POINTING_CPI) |
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
 #    define TRANSACTIONS_POINTING_MASTER()
 #    define TRANSACTIONS_POINTING_SLAVE()
 #    define TRANSACTIONS_POINTING_REGISTRATIONS
+#    define TRANSACTIONS_POINTING_BATCHED
 
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -847,6 +898,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER(haptic)
 #    define TRANSACTIONS_HAPTIC_SLAVE() TRANSACTION_HANDLER_SLAVE(haptic)
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS [PUT_HAPTIC] = trans_initiator2target_initializer(haptic_sync),
+#    define TRANSACTIONS_HAPTIC_BATCHED SPLIT_BATCH_BIT(PUT_HAPTIC) |
 // clang-format on
 
 #else // defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
@@ -854,6 +906,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #    define TRANSACTIONS_HAPTIC_MASTER()
 #    define TRANSACTIONS_HAPTIC_SLAVE()
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS
+#    define TRANSACTIONS_HAPTIC_BATCHED
 
 #endif // defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
 
@@ -876,6 +929,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER(activity)
 #    define TRANSACTIONS_ACTIVITY_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(activity)
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS [PUT_ACTIVITY] = trans_initiator2target_initializer(activity_sync),
+#    define TRANSACTIONS_ACTIVITY_BATCHED SPLIT_BATCH_BIT(PUT_ACTIVITY) |
 // clang-format on
 
 #else // defined(SPLIT_ACTIVITY_ENABLE)
@@ -883,6 +937,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_ACTIVITY_MASTER()
 #    define TRANSACTIONS_ACTIVITY_SLAVE()
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS
+#    define TRANSACTIONS_ACTIVITY_BATCHED
 
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
@@ -905,15 +960,154 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #    define TRANSACTIONS_DETECTED_OS_MASTER() TRANSACTION_HANDLER_MASTER(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_REGISTRATIONS [PUT_DETECTED_OS] = trans_initiator2target_initializer(detected_os),
+#    define TRANSACTIONS_DETECTED_OS_BATCHED SPLIT_BATCH_BIT(PUT_DETECTED_OS) |
 
 #else // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
 #    define TRANSACTIONS_DETECTED_OS_MASTER()
 #    define TRANSACTIONS_DETECTED_OS_SLAVE()
 #    define TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+#    define TRANSACTIONS_DETECTED_OS_BATCHED
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Batch
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+STATIC_ASSERT(SPLIT_TRANSPORT_BATCH_SIZE <= UINT8_MAX, "SPLIT_TRANSPORT_BATCH_SIZE must fit in a transaction buffer");
+
+// Transactions past the width of the mask are never batched
+#    define SPLIT_BATCH_BIT(id) ((id) < 32 ? (uint32_t)1 << (id) : 0)
+
+#    if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+#        define SPLIT_BATCH_LAST_ID PUT_DETECTED_OS
+#    else
+#        define SPLIT_BATCH_LAST_ID (CMD_BATCH_SYNC - 1)
+#    endif
+
+STATIC_ASSERT(SPLIT_BATCH_LAST_ID < 32, "Batched transactions must fit in the batch mask");
+
+// clang-format off
+#    define SPLIT_BATCHED_TRANSACTIONS ( \
+    TRANSACTIONS_MASTER_MATRIX_BATCHED \
+    TRANSACTIONS_LAYER_STATE_BATCHED \
+    TRANSACTIONS_LED_STATE_BATCHED \
+    TRANSACTIONS_MODS_BATCHED \
+    TRANSACTIONS_BACKLIGHT_BATCHED \
+    TRANSACTIONS_RGBLIGHT_BATCHED \
+    TRANSACTIONS_LED_MATRIX_BATCHED \
+    TRANSACTIONS_RGB_MATRIX_BATCHED \
+    TRANSACTIONS_WPM_BATCHED \
+    TRANSACTIONS_OLED_BATCHED \
+    TRANSACTIONS_ST7565_BATCHED \
+    TRANSACTIONS_POINTING_BATCHED \
+    TRANSACTIONS_HAPTIC_BATCHED \
+    TRANSACTIONS_ACTIVITY_BATCHED \
+    TRANSACTIONS_DETECTED_OS_BATCHED \
+    0)
+// clang-format on
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // What the slave has acknowledged holding, and which transactions it may not hold at all
+    static split_shared_memory_t acked;
+    static uint32_t              unacked     = SPLIT_BATCHED_TRANSACTIONS;
+    static uint32_t              last_update = 0;
+
+    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+        // Send everything in full now and then, in case the slave has been reset
+        unacked     = SPLIT_BATCHED_TRANSACTIONS;
+        last_update = timer_read32();
+    }
+
+    uint8_t  frame[SPLIT_TRANSPORT_BATCH_SIZE];
+    uint32_t sent = 0;
+    split_batch_frame_init(frame);
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        if (!(SPLIT_BATCHED_TRANSACTIONS & SPLIT_BATCH_BIT(id))) {
+            continue;
+        }
+        split_transaction_desc_t *trans   = &split_transaction_table[id];
+        uint8_t                  *current = split_trans_initiator2target_buffer(trans);
+        uint8_t                  *last    = ((uint8_t *)&acked) + trans->initiator2target_offset;
+        uint8_t                   length  = trans->initiator2target_buffer_size;
+
+        if (length + SPLIT_BATCH_ENTRY_HEADER_SIZE + SPLIT_BATCH_FRAME_OVERHEAD > SPLIT_TRANSPORT_BATCH_SIZE) {
+            // Never fits in a frame, so goes on its own
+            if ((unacked & SPLIT_BATCH_BIT(id)) || memcmp(current, last, length) != 0) {
+                if (!transport_write(id, current, length)) {
+                    return false;
+                }
+                memcpy(last, current, length);
+                unacked &= ~SPLIT_BATCH_BIT(id);
+            }
+            continue;
+        }
+        // Anything that does not fit is left for the next frame
+        if (split_batch_frame_add_delta(frame, sizeof(frame), id, current, (unacked & SPLIT_BATCH_BIT(id)) ? NULL : last, length)) {
+            sent |= SPLIT_BATCH_BIT(id);
+        }
+    }
+
+    if (split_batch_frame_is_empty(frame)) {
+        return true;
+    }
+
+    uint8_t checksum = split_batch_frame_seal(frame);
+    uint8_t ack      = ~checksum;
+    if (!transport_execute_transaction(CMD_BATCH_SYNC, frame, sizeof(frame), &ack, sizeof(ack)) || ack != checksum) {
+        return false;
+    }
+
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        if (sent & SPLIT_BATCH_BIT(id)) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            memcpy(((uint8_t *)&acked) + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        }
+    }
+    unacked &= ~sent;
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    // The slave clears the change flags once it has acted on them, so they have to be sent again every time
+    acked.rgblight_sync.status.change_flags = 0;
+    if (sent & SPLIT_BATCH_BIT(PUT_RGBLIGHT)) {
+        // Only a new change stages them again, otherwise the same ones would be resent on every scan
+        split_shmem->rgblight_sync.status.change_flags = 0;
+    }
+#    endif
+    return true;
+}
+
+static void batch_apply_entry(int8_t id, uint8_t offset, const uint8_t *data, uint8_t length) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || !(SPLIT_BATCHED_TRANSACTIONS & SPLIT_BATCH_BIT(id))) {
+        return;
+    }
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (offset + length > trans->initiator2target_buffer_size) {
+        return;
+    }
+    memcpy(split_trans_initiator2target_buffer(trans) + offset, data, length);
+}
+
+static void batch_handlers_slave_apply(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // The applied data is picked up by each transaction's slave handler, as if it had been sent on its own
+    uint8_t checksum;
+    bool    okay           = split_batch_frame_apply(split_shmem->batch.frame, sizeof(split_shmem->batch.frame), batch_apply_entry, &checksum);
+    split_shmem->batch.ack = okay ? checksum : (uint8_t)~checksum;
+}
+
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_SLAVE()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS [CMD_BATCH_SYNC] = trans_bidirectional_initializer_cb(batch.frame, batch.ack, batch_handlers_slave_apply),
+
+#else // SPLIT_TRANSPORT_BATCH
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_SLAVE()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BATCH
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -944,6 +1138,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -974,6 +1169,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
@@ -997,6 +1193,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_BATCH_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
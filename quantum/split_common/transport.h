@@ -67,6 +67,7 @@ typedef struct _split_master_matrix_sync_t {
 typedef struct _split_slave_encoder_sync_t {
     uint8_t          checksum;
     encoder_events_t events;
+    uint8_t          drained;
 } split_slave_encoder_sync_t;
 #endif // ENCODER_ENABLE
 
@@ -147,6 +148,17 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+#    ifndef SPLIT_TRANSPORT_BATCH_SIZE
+#        define SPLIT_TRANSPORT_BATCH_SIZE 32
+#    endif // SPLIT_TRANSPORT_BATCH_SIZE
+
+typedef struct _split_batch_sync_t {
+    uint8_t frame[SPLIT_TRANSPORT_BATCH_SIZE];
+    uint8_t ack;
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
@@ -231,6 +243,10 @@ typedef struct _split_shared_memory_t {
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
     os_variant_t detected_os;
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
 } split_shared_memory_t;
 
 extern split_shared_memory_t *const split_shmem;
@@ -0,0 +1,83 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "task_scheduler.h"
+#include "timer.h"
+
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+
+// Every task runs once on the first pass of the main loop, and then whenever it asks to
+static uint32_t          deadlines[SCHEDULED_TASK_COUNT] = {0};
+static scheduled_tasks_t scheduled                       = SCHEDULED_TASK_BIT(SCHEDULED_TASK_COUNT) - 1;
+// No later than the earliest deadline, so that nothing needs looking at until then
+static uint32_t earliest = 0;
+
+static inline bool is_before(uint32_t a, uint32_t b) {
+    return ((int32_t)TIMER_DIFF_32(a, b)) < 0;
+}
+
+void task_schedule_in(scheduled_task_t task, uint32_t delay_ms) {
+    if (task >= SCHEDULED_TASK_COUNT) {
+        return;
+    }
+
+    uint32_t deadline = timer_read32() + delay_ms;
+    deadlines[task]   = deadline;
+    if (!scheduled || is_before(deadline, earliest)) {
+        earliest = deadline;
+    }
+    scheduled |= SCHEDULED_TASK_BIT(task);
+}
+
+scheduled_tasks_t task_scheduler_take_due(void) {
+    // Fast path for the main loop, nothing is due yet
+    if (!scheduled) {
+        return 0;
+    }
+    uint32_t now = timer_read32();
+    if (is_before(now, earliest)) {
+        return 0;
+    }
+
+    scheduled_tasks_t due  = 0;
+    bool              next = false;
+    for (uint8_t task = 0; task < SCHEDULED_TASK_COUNT; ++task) {
+        if (!(scheduled & SCHEDULED_TASK_BIT(task))) {
+            continue;
+        }
+        if (!is_before(now, deadlines[task])) {
+            due |= SCHEDULED_TASK_BIT(task);
+        } else if (!next || is_before(deadlines[task], earliest)) {
+            earliest = deadlines[task];
+            next     = true;
+        }
+    }
+    scheduled &= ~due;
+    return due;
+}
+
+bool task_scheduler_next_deadline(uint32_t *deadline) {
+    bool     found   = false;
+    uint32_t soonest = 0;
+    for (uint8_t task = 0; task < SCHEDULED_TASK_COUNT; ++task) {
+        if ((scheduled & SCHEDULED_TASK_BIT(task)) && (!found || is_before(deadlines[task], soonest))) {
+            soonest = deadlines[task];
+            found   = true;
+        }
+    }
+
+#ifdef DEFERRED_EXEC_ENABLE
+    uint32_t trigger_time;
+    if (deferred_exec_next_trigger(&trigger_time) && (!found || is_before(trigger_time, soonest))) {
+        soonest = trigger_time;
+        found   = true;
+    }
+#endif
+
+    if (found) {
+        *deadline = soonest;
+    }
+    return found;
+}
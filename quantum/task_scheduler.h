@@ -0,0 +1,58 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "compiler_support.h"
+
+/**
+ * @enum The quantum_task subsystems that only run once they are due.
+ */
+typedef enum scheduled_task_t {
+    SCHEDULED_TASK_TAP_DANCE,
+    SCHEDULED_TASK_COMBO,
+    SCHEDULED_TASK_LEADER,
+    SCHEDULED_TASK_WPM,
+    SCHEDULED_TASK_CAPS_WORD,
+    SCHEDULED_TASK_SECURE,
+    SCHEDULED_TASK_LAYER_LOCK,
+    SCHEDULED_TASK_COUNT,
+} scheduled_task_t;
+
+/**
+ * @typedef A set of scheduled tasks, one bit per scheduled_task_t.
+ */
+typedef uint8_t scheduled_tasks_t;
+
+#define SCHEDULED_TASK_BIT(task) ((scheduled_tasks_t)1 << (task))
+
+STATIC_ASSERT(SCHEDULED_TASK_COUNT <= 8 * sizeof(scheduled_tasks_t), "Too many scheduled tasks for scheduled_tasks_t");
+
+/**
+ * Requests the task is run once delay_ms milliseconds have passed, replacing any earlier request.
+ *
+ * Subsystems call this with a delay of 0 whenever their state changes, and the task itself asks
+ * again for the remaining time while it is still waiting on a timeout.
+ *
+ * @param task[in] the task to run
+ * @param delay_ms[in] the number of milliseconds before it is due, 0 for the next pass of the main loop
+ */
+void task_schedule_in(scheduled_task_t task, uint32_t delay_ms);
+
+/**
+ * Collects the tasks that are due. They are unscheduled again, so each runs once per request.
+ *
+ * @return the set of tasks to run on this pass of the main loop
+ */
+scheduled_tasks_t task_scheduler_take_due(void);
+
+/**
+ * Gets the earliest time any scheduled task, or deferred execution, is due. Until then the main loop
+ * only has to react to the matrix and host, and could idle.
+ *
+ * @param deadline[out] the earliest deadline -- equivalent time-space as timer_read32()
+ * @return true if anything is scheduled, otherwise false and deadline is left unchanged
+ */
+bool task_scheduler_next_deadline(uint32_t *deadline);
@@ -0,0 +1,198 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/*
+    Times queueing executors, a main loop pass with nothing due, and 20s of repeating timeouts, with the heap
+    ordered executor tables and the flat table scan they replaced, at 8, 64 and 255 executors -- deferred tokens
+    are 8 bits wide, so 255 is as many as a table can hold.
+*/
+
+namespace {
+
+// Flat table versions, as used before
+deferred_token table_current_token = 0;
+
+bool table_token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    for (size_t i = 0; i < table_count; ++i) {
+        if (table[i].token == token) {
+            return false;
+        }
+    }
+    return true;
+}
+
+deferred_token table_allocate_token(deferred_executor_t *table, size_t table_count) {
+    deferred_token first = ++table_current_token;
+    while (!table_token_can_be_used(table, table_count, table_current_token)) {
+        ++table_current_token;
+        if (table_current_token == first) {
+            return INVALID_DEFERRED_TOKEN;
+        }
+    }
+    return table_current_token;
+}
+
+deferred_token table_defer_exec(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    for (size_t i = 0; i < table_count; ++i) {
+        deferred_executor_t *entry = &table[i];
+        if (entry->token == INVALID_DEFERRED_TOKEN) {
+            if (table_allocate_token(table, table_count) == INVALID_DEFERRED_TOKEN) {
+                return INVALID_DEFERRED_TOKEN;
+            }
+            entry->token        = table_current_token;
+            entry->trigger_time = timer_read32() + delay_ms;
+            entry->callback     = callback;
+            entry->cb_arg       = cb_arg;
+            return table_current_token;
+        }
+    }
+    return INVALID_DEFERRED_TOKEN;
+}
+
+void table_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+    uint32_t now = timer_read32();
+    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
+        *last_execution_time = now;
+        for (size_t i = 0; i < table_count; ++i) {
+            deferred_executor_t *entry      = &table[i];
+            deferred_token       curr_token = entry->token;
+            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+                if (entry->token != curr_token) {
+                    continue;
+                }
+                if (delay_ms > 0) {
+                    entry->trigger_time += delay_ms;
+                } else {
+                    entry->token        = INVALID_DEFERRED_TOKEN;
+                    entry->trigger_time = 0;
+                    entry->callback     = NULL;
+                    entry->cb_arg       = NULL;
+                }
+            }
+        }
+    }
+}
+
+typedef deferred_token (*defer_fn)(deferred_executor_t *, size_t, uint32_t, deferred_exec_callback, void *);
+typedef void (*task_fn)(deferred_executor_t *, size_t, uint32_t *);
+
+struct Backend {
+    const char *name;
+    defer_fn    defer;
+    task_fn     task;
+};
+
+const Backend backends[] = {
+    {"table", table_defer_exec, table_task},
+    {"heap", defer_exec_advanced, deferred_exec_advanced_task},
+};
+
+unsigned executions = 0;
+
+// A per-key style timeout, repeating every 20-60ms
+uint32_t repeating_callback(uint32_t trigger_time, void *cb_arg) {
+    executions++;
+    return 20 + reinterpret_cast<uintptr_t>(cb_arg) % 41;
+}
+
+double ns_since(std::chrono::steady_clock::time_point start, unsigned count) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+} // namespace
+
+class DeferredExecBenchmark : public ::testing::TestWithParam<size_t> {
+   protected:
+    void SetUp() override {
+        set_time(0);
+    }
+
+    // Queues `count` executors into an empty table, returning the time taken per executor
+    double fill(const Backend &backend, std::vector<deferred_executor_t> &table) {
+        std::fill(table.begin(), table.end(), deferred_executor_t{});
+        auto start = std::chrono::steady_clock::now();
+        for (uintptr_t i = 0; i < table.size(); i++) {
+            EXPECT_NE(backend.defer(table.data(), table.size(), 1000 + i, repeating_callback, reinterpret_cast<void *>(i)), INVALID_DEFERRED_TOKEN);
+        }
+        return ns_since(start, table.size());
+    }
+
+    void record(const char *what, const Backend &backend, double ns) {
+        std::string name = std::string(what) + "_" + backend.name + "_" + std::to_string(GetParam()) + "_ns";
+        std::cout << "deferred_exec " << std::setw(5) << GetParam() << " executors, " << std::setw(5) << backend.name << " " << what << ": " << ns << "ns" << std::endl;
+        RecordProperty(name, std::to_string(ns));
+    }
+};
+
+TEST_P(DeferredExecBenchmark, Defer) {
+    for (const Backend &backend : backends) {
+        std::vector<deferred_executor_t> table(GetParam());
+        const unsigned                   rounds = 20000 / GetParam() + 1;
+        double                           total  = 0;
+        for (unsigned round = 0; round < rounds; round++) {
+            total += fill(backend, table);
+        }
+        record("defer", backend, total / rounds);
+    }
+}
+
+TEST_P(DeferredExecBenchmark, IdleTask) {
+    const unsigned iterations = 200000;
+    for (const Backend &backend : backends) {
+        std::vector<deferred_executor_t> table(GetParam());
+        fill(backend, table);
+
+        // Nothing is due, this is the cost the main loop pays on every pass
+        uint32_t last_execution;
+        auto     start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; i++) {
+            last_execution = timer_read32() - 1;
+            backend.task(table.data(), table.size(), &last_execution);
+        }
+        record("idle_task", backend, ns_since(start, iterations));
+    }
+}
+
+TEST_P(DeferredExecBenchmark, RepeatingTimeouts) {
+    const unsigned milliseconds = 20000;
+    unsigned       counts[2]    = {};
+
+    for (size_t b = 0; b < 2; b++) {
+        const Backend                   &backend = backends[b];
+        std::vector<deferred_executor_t> table(GetParam());
+        set_time(0);
+        fill(backend, table);
+
+        uint32_t last_execution = 0;
+        executions              = 0;
+        auto start              = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < milliseconds; i++) {
+            advance_time(1);
+            backend.task(table.data(), table.size(), &last_execution);
+        }
+        record("task_per_ms", backend, ns_since(start, milliseconds));
+        counts[b] = executions;
+    }
+
+    // Both have to do the same work
+    EXPECT_EQ(counts[0], counts[1]);
+    EXPECT_GT(counts[1], 0);
+}
+
+INSTANTIATE_TEST_CASE_P(Executors, DeferredExecBenchmark, ::testing::Values(8, 64, 255));
@@ -0,0 +1,285 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+const size_t table_count = 16;
+
+struct Call {
+    uintptr_t id;
+    uint32_t  trigger_time;
+    uint32_t  now;
+};
+
+std::vector<Call>                   calls;
+std::map<uintptr_t, uint32_t>       repeat_delays;
+deferred_executor_t                *callback_table       = nullptr;
+size_t                              callback_table_count = 0;
+std::map<uintptr_t, deferred_token> tokens;
+
+uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    uintptr_t id = reinterpret_cast<uintptr_t>(cb_arg);
+    calls.push_back({id, trigger_time, timer_read32()});
+    auto repeat = repeat_delays.find(id);
+    return repeat == repeat_delays.end() ? 0 : repeat->second;
+}
+
+// Cancels itself and queues a replacement, with the same id
+uint32_t requeue_callback(uint32_t trigger_time, void *cb_arg) {
+    record_callback(trigger_time, cb_arg);
+    uintptr_t id = reinterpret_cast<uintptr_t>(cb_arg);
+    EXPECT_TRUE(cancel_deferred_exec_advanced(callback_table, callback_table_count, tokens[id]));
+    tokens[id] = defer_exec_advanced(callback_table, callback_table_count, 5, record_callback, cb_arg);
+    return 100;
+}
+
+// Queues a second executor, which moves entries in the table around
+uint32_t spawn_callback(uint32_t trigger_time, void *cb_arg) {
+    record_callback(trigger_time, cb_arg);
+    for (uintptr_t i = 0; i < 4; i++) {
+        defer_exec_advanced(callback_table, callback_table_count, 1 + i, record_callback, reinterpret_cast<void *>(1000 + i));
+    }
+    return 10;
+}
+
+void *id_arg(uintptr_t id) {
+    return reinterpret_cast<void *>(id);
+}
+
+} // namespace
+
+class DeferredExec : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        calls.clear();
+        repeat_delays.clear();
+        tokens.clear();
+        memset(table, 0, sizeof(table));
+        callback_table       = table;
+        callback_table_count = table_count;
+        last_execution       = 0;
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id, deferred_exec_callback callback = record_callback) {
+        deferred_token token = defer_exec_advanced(table, table_count, delay_ms, callback, id_arg(id));
+        tokens[id]           = token;
+        return token;
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, table_count, &last_execution);
+        }
+    }
+
+    std::vector<uintptr_t> called_ids() {
+        std::vector<uintptr_t> ids;
+        for (auto &call : calls) {
+            ids.push_back(call.id);
+        }
+        return ids;
+    }
+
+    deferred_executor_t table[table_count];
+    uint32_t            last_execution;
+};
+
+TEST_F(DeferredExec, RunsInTriggerOrder) {
+    defer(30, 3);
+    defer(10, 1);
+    defer(20, 2);
+    defer(25, 4);
+    run_for(40);
+
+    EXPECT_EQ(called_ids(), (std::vector<uintptr_t>{1, 2, 4, 3}));
+    for (auto &call : calls) {
+        EXPECT_EQ(call.now, call.trigger_time) << "executor " << call.id << " ran late";
+    }
+}
+
+TEST_F(DeferredExec, Repeat_IsRelativeToTheTrigger) {
+    repeat_delays[1] = 7;
+    defer(5, 1);
+    run_for(5 + 7 * 3);
+
+    ASSERT_EQ(calls.size(), 4);
+    for (size_t i = 0; i < calls.size(); i++) {
+        EXPECT_EQ(calls[i].trigger_time, 5 + 7 * i);
+    }
+}
+
+TEST_F(DeferredExec, Cancel_KeepsTheOthersInOrder) {
+    for (uintptr_t id = 1; id <= 10; id++) {
+        defer(id * 3, id);
+    }
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, tokens[4]));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, tokens[1]));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, table_count, tokens[1]));
+    run_for(40);
+
+    EXPECT_EQ(called_ids(), (std::vector<uintptr_t>{2, 3, 5, 6, 7, 8, 9, 10}));
+}
+
+TEST_F(DeferredExec, Extend_MovesTheTrigger) {
+    defer(10, 1);
+    defer(20, 2);
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, table_count, tokens[1], 30));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, table_count, INVALID_DEFERRED_TOKEN, 30));
+    run_for(40);
+
+    ASSERT_EQ(called_ids(), (std::vector<uintptr_t>{2, 1}));
+    EXPECT_EQ(calls[1].now, 35);
+}
+
+TEST_F(DeferredExec, NextTrigger_IsTheEarliest) {
+    uint32_t trigger_time = 1234;
+    EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+    EXPECT_EQ(trigger_time, 1234);
+
+    defer(50, 1);
+    defer(20, 2);
+    defer(30, 3);
+    ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+    EXPECT_EQ(trigger_time, 20);
+
+    cancel_deferred_exec_advanced(table, table_count, tokens[2]);
+    ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+    EXPECT_EQ(trigger_time, 30);
+
+    run_for(50);
+    EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+}
+
+TEST_F(DeferredExec, CallbackRequeuesItself) {
+    defer(10, 1, requeue_callback);
+    run_for(30);
+
+    // The replacement runs instead of the repeat the callback asked for
+    ASSERT_EQ(calls.size(), 2);
+    EXPECT_EQ(calls[0].now, 10);
+    EXPECT_EQ(calls[1].now, 15);
+}
+
+TEST_F(DeferredExec, CallbackQueuesOthers) {
+    defer(19, 2);
+    defer(10, 1, spawn_callback);
+    run_for(16);
+
+    EXPECT_EQ(called_ids(), (std::vector<uintptr_t>{1, 1000, 1001, 1002, 1003}));
+    run_for(4);
+    EXPECT_EQ(called_ids(), (std::vector<uintptr_t>{1, 1000, 1001, 1002, 1003, 2, 1}));
+}
+
+TEST_F(DeferredExec, FullTable_RejectsMore) {
+    for (uintptr_t id = 0; id < table_count; id++) {
+        EXPECT_NE(defer(100 + id, id), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(10, 99), INVALID_DEFERRED_TOKEN);
+
+    cancel_deferred_exec_advanced(table, table_count, tokens[5]);
+    EXPECT_NE(defer(10, 99), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, Tokens_AreUniqueAfterWrapping) {
+    // Keep some long running executors while cycling through every token value several times
+    for (uintptr_t id = 0; id < table_count / 2; id++) {
+        defer(10000, id);
+    }
+    for (int i = 0; i < 1000; i++) {
+        deferred_token token = defer(5000, 100);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        for (uintptr_t id = 0; id < table_count / 2; id++) {
+            ASSERT_NE(token, tokens[id]);
+        }
+        ASSERT_TRUE(cancel_deferred_exec_advanced(table, table_count, token));
+    }
+}
+
+TEST_F(DeferredExec, TimerWraparound) {
+    set_time(UINT32_MAX - 10);
+    last_execution = timer_read32();
+    defer(20, 2);
+    defer(5, 1);
+    defer(15, 3);
+    run_for(25);
+
+    EXPECT_EQ(called_ids(), (std::vector<uintptr_t>{1, 3, 2}));
+}
+
+TEST_F(DeferredExec, RandomOperations_MatchAModel) {
+    std::mt19937                  rng(42);
+    std::map<uintptr_t, uint32_t> expected; // id -> trigger time
+    uintptr_t                     next_id = 1;
+
+    for (int step = 0; step < 2000; step++) {
+        switch (rng() % 4) {
+            case 0:
+            case 1: {
+                uint32_t delay = 1 + rng() % 50;
+                if (defer(delay, next_id) != INVALID_DEFERRED_TOKEN) {
+                    expected[next_id] = timer_read32() + delay;
+                } else {
+                    EXPECT_EQ(expected.size(), table_count);
+                }
+                next_id++;
+                break;
+            }
+            case 2:
+                if (!expected.empty()) {
+                    auto victim = std::next(expected.begin(), rng() % expected.size());
+                    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, tokens[victim->first]));
+                    expected.erase(victim);
+                }
+                break;
+            case 3:
+                if (!expected.empty()) {
+                    auto     target = std::next(expected.begin(), rng() % expected.size());
+                    uint32_t delay  = 1 + rng() % 50;
+                    EXPECT_TRUE(extend_deferred_exec_advanced(table, table_count, tokens[target->first], delay));
+                    target->second = timer_read32() + delay;
+                }
+                break;
+        }
+
+        uint32_t trigger_time;
+        if (expected.empty()) {
+            EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+        } else {
+            uint32_t earliest = std::min_element(expected.begin(), expected.end(), [](auto &a, auto &b) { return a.second < b.second; })->second;
+            ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+            EXPECT_EQ(trigger_time, earliest);
+        }
+
+        calls.clear();
+        run_for(1);
+        std::set<uintptr_t> due;
+        for (auto it = expected.begin(); it != expected.end();) {
+            if (it->second <= timer_read32()) {
+                due.insert(it->first);
+                it = expected.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        std::vector<uintptr_t> ran = called_ids();
+        EXPECT_EQ(std::set<uintptr_t>(ran.begin(), ran.end()), due) << "at step " << step;
+        EXPECT_EQ(ran.size(), due.size());
+    }
+}
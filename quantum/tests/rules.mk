@@ -0,0 +1,6 @@
+deferred_exec_SRC := \
+	$(QUANTUM_PATH)/tests/deferred_exec_tests.cpp \
+	$(QUANTUM_PATH)/tests/deferred_exec_benchmark.cpp \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
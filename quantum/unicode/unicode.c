@@ -208,6 +208,10 @@ void unicode_input_mode_step_reverse(void) {
 }
 
 __attribute__((weak)) void unicode_input_start(void) {
+#ifdef SEND_STRING_NONBLOCKING
+    // Keys are held below, the queued strings have to be typed before that
+    send_string_flush();
+#endif
     unicode_saved_led_state = host_keyboard_led_state();
 
     // Note the order matters here!
@@ -235,6 +239,7 @@ __attribute__((weak)) void unicode_input_start(void) {
                 tap_code(KC_NUM_LOCK);
             }
             register_code(KC_LEFT_ALT);
+            host_keyboard_flush();
             wait_ms(UNICODE_TYPE_DELAY);
             tap_code(KC_KP_PLUS);
             break;
@@ -250,10 +255,15 @@ __attribute__((weak)) void unicode_input_start(void) {
             break;
     }
 
+    host_keyboard_flush();
     wait_ms(UNICODE_TYPE_DELAY);
 }
 
 __attribute__((weak)) void unicode_input_finish(void) {
+#ifdef SEND_STRING_NONBLOCKING
+    // The hex digits are queued, type them before the held keys are released
+    send_string_flush();
+#endif
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
             unregister_code(UNICODE_KEY_MAC);
@@ -282,6 +292,10 @@ __attribute__((weak)) void unicode_input_finish(void) {
 }
 
 __attribute__((weak)) void unicode_input_cancel(void) {
+#ifdef SEND_STRING_NONBLOCKING
+    // The hex digits are queued, type them before the held keys are released
+    send_string_flush();
+#endif
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
             unregister_code(UNICODE_KEY_MAC);
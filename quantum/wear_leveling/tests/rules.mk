@@ -64,3 +64,23 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_write_through_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=1024 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=64
+wear_leveling_write_through_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_back.cpp
+wear_leveling_write_through_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_write_back_DEFS := \
+	$(wear_leveling_write_through_DEFS) \
+	-DWEAR_LEVELING_WRITE_BACK \
+	-DWEAR_LEVELING_WRITE_BACK_RANGES=4
+wear_leveling_write_back_SRC := \
+	$(wear_leveling_write_through_SRC)
+wear_leveling_write_back_INC := \
+	$(wear_leveling_common_INC)
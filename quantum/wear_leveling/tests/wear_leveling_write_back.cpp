@@ -0,0 +1,227 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <iostream>
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+/*
+    Built twice: once as-is (write-through) and once with WEAR_LEVELING_WRITE_BACK, so that the backing store usage of
+    both modes can be compared for the same sequence of writes.
+*/
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+static const char* const mode = "write-back";
+#else
+static const char* const mode = "write-through";
+#    define WEAR_LEVELING_WRITE_BACK_RANGES 4
+#endif
+
+class WearLevelingWriteBack : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    // Loses anything which was not committed to the backing store, as a power loss would
+    void power_cycle() {
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    }
+
+    uint8_t read_byte(uint32_t address) {
+        uint8_t value = 0;
+        EXPECT_EQ(wear_leveling_read(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        return value;
+    }
+
+    void report(const char* name, std::uint64_t requested_writes) {
+        auto& inst = MockBackingStore::Instance();
+        std::cout << mode << " " << name << ": writes=" << requested_writes << " backing_writes=" << inst.total_write_count() << " erases=" << inst.erasure_count() << std::endl;
+        RecordProperty(std::string(name) + "_backing_writes", static_cast<int>(inst.total_write_count()));
+        RecordProperty(std::string(name) + "_erases", static_cast<int>(inst.erasure_count()));
+    }
+};
+
+/**
+ * This test verifies that reads return written data straight away, regardless of whether it has been committed.
+ */
+TEST_F(WearLevelingWriteBack, ReadsSeeBufferedWrites) {
+    uint8_t test_val = 0x5A;
+    EXPECT_NE(wear_leveling_write(0x10, &test_val, sizeof(test_val)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    EXPECT_EQ(read_byte(0x10), 0x5A) << "Invalid readback";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_FALSE(wear_leveling_dirty()) << "Nothing should be left to commit";
+    EXPECT_EQ(read_byte(0x10), 0x5A) << "Invalid readback";
+}
+
+/**
+ * This test verifies that a power loss before a flush leaves the backing store with the previously committed data.
+ */
+TEST_F(WearLevelingWriteBack, PowerLoss_KeepsLastCommittedState) {
+    uint8_t test_val = 0x01;
+    EXPECT_NE(wear_leveling_write(0x20, &test_val, sizeof(test_val)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    test_val = 0x02;
+    EXPECT_NE(wear_leveling_write(0x20, &test_val, sizeof(test_val)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    power_cycle();
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+    EXPECT_EQ(read_byte(0x20), 0x01) << "Uncommitted write should have been lost";
+#else
+    EXPECT_EQ(read_byte(0x20), 0x02) << "Write should have been committed immediately";
+#endif
+    EXPECT_FALSE(wear_leveling_dirty()) << "Nothing should be left to commit";
+}
+
+/**
+ * This test verifies that overlapping and adjacent writes are merged, and that all of them are committed by a flush.
+ */
+TEST_F(WearLevelingWriteBack, Flush_CommitsMergedRanges) {
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    auto                                                 write = [&expected](uint32_t address, std::initializer_list<uint8_t> values) {
+        std::copy(values.begin(), values.end(), expected.begin() + address);
+        EXPECT_NE(wear_leveling_write(address, values.begin(), values.size()), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    };
+
+    write(0x04, {0x11, 0x12, 0x13});
+    write(0x06, {0x21, 0x22, 0x23}); // overlaps the first
+    write(0x09, {0x31});             // touches the second
+    write(0x30, {0x41, 0x42});
+    write(0x2E, {0x51, 0x52}); // touches the fourth
+#ifdef WEAR_LEVELING_WRITE_BACK
+    EXPECT_TRUE(wear_leveling_dirty()) << "Writes should have been buffered";
+    EXPECT_EQ(MockBackingStore::Instance().total_write_count(), 0) << "Nothing should have been written yet";
+#endif
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_FALSE(wear_leveling_dirty()) << "Nothing should be left to commit";
+    power_cycle();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual{};
+    EXPECT_EQ(wear_leveling_read(0, actual.data(), actual.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(actual, ::testing::ElementsAreArray(expected)) << "Invalid readback";
+}
+
+/**
+ * This test verifies that running out of dirty ranges commits the buffered ones, and keeps buffering the latest write.
+ */
+TEST_F(WearLevelingWriteBack, RangeOverflow_CommitsBufferedRanges) {
+    for (uint8_t i = 0; i <= WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        uint8_t test_val = 0x80 + i;
+        EXPECT_NE(wear_leveling_write(i * 4, &test_val, sizeof(test_val)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+    power_cycle();
+
+    for (uint8_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        EXPECT_EQ(read_byte(i * 4), 0x80 + i) << "Committed write was lost";
+    }
+#ifdef WEAR_LEVELING_WRITE_BACK
+    EXPECT_EQ(read_byte(WEAR_LEVELING_WRITE_BACK_RANGES * 4), 0x00) << "Latest write should still have been buffered";
+#else
+    EXPECT_EQ(read_byte(WEAR_LEVELING_WRITE_BACK_RANGES * 4), 0x80 + WEAR_LEVELING_WRITE_BACK_RANGES) << "Write should have been committed immediately";
+#endif
+}
+
+/**
+ * This test verifies that a power loss at any point while committing leaves every byte with either its old or new value,
+ * and that a failed flush can be retried.
+ */
+TEST_F(WearLevelingWriteBack, InterruptedCommit_IsConsistent) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> old_data;
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> new_data;
+    std::iota(old_data.begin(), old_data.end(), 0x10);
+    std::iota(new_data.begin(), new_data.end(), 0xA0);
+
+    for (std::uint64_t allowed = 0; allowed < 24; ++allowed) {
+        inst.reset_instance();
+        wear_leveling_init();
+        EXPECT_NE(wear_leveling_write(0, old_data.data(), old_data.size()), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+        // Allow only the given number of backing store writes to succeed
+        std::uint64_t base = inst.write_invoke_count();
+        inst.set_write_callback([base, allowed](std::uint64_t count, std::uint32_t) { return count - base <= allowed; });
+        bool failed = false;
+        for (size_t i = 0; i < new_data.size(); i += 8) {
+            failed |= wear_leveling_write(i, &new_data[i], 3) == WEAR_LEVELING_FAILED;
+        }
+        failed |= wear_leveling_flush() == WEAR_LEVELING_FAILED;
+        inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+        if (failed) {
+            EXPECT_TRUE(wear_leveling_dirty()) << "Failed ranges should still need committing";
+
+            // Retry once the backing store works again
+            EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Retried flush returned incorrect status";
+            EXPECT_FALSE(wear_leveling_dirty()) << "Nothing should be left to commit";
+            power_cycle();
+            for (size_t i = 0; i < new_data.size(); ++i) {
+                EXPECT_EQ(read_byte(i), (i % 8) < 3 ? new_data[i] : old_data[i]) << "Retried flush lost data at " << i;
+            }
+            continue;
+        }
+#endif
+        power_cycle();
+        for (size_t i = 0; i < new_data.size(); ++i) {
+            uint8_t value = read_byte(i);
+            EXPECT_TRUE(value == old_data[i] || ((i % 8) < 3 && value == new_data[i])) << "Corrupted data at " << i << " after " << allowed << " writes";
+        }
+    }
+}
+
+/**
+ * This test measures the backing store usage of repeatedly stepping a single setting, as RGB hue adjustments do.
+ */
+TEST_F(WearLevelingWriteBack, WriteAmplification_SettingStepping) {
+    const int steps = 300;
+    for (int i = 0; i < steps; ++i) {
+        uint8_t hue = i;
+        EXPECT_NE(wear_leveling_write(0x08, &hue, sizeof(hue)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+    EXPECT_NE(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush returned incorrect status";
+    report("setting_stepping", steps);
+
+    auto& inst = MockBackingStore::Instance();
+#ifdef WEAR_LEVELING_WRITE_BACK
+    EXPECT_EQ(inst.total_write_count(), 1) << "Steps should have been coalesced into a single log entry";
+    EXPECT_EQ(inst.erasure_count(), 0) << "Log should not have needed consolidation";
+#else
+    EXPECT_GE(inst.total_write_count(), steps) << "Every step should have been written";
+    EXPECT_GT(inst.erasure_count(), 0) << "Log should have needed consolidation";
+#endif
+
+    power_cycle();
+    EXPECT_EQ(read_byte(0x08), (uint8_t)(steps - 1)) << "Invalid readback";
+}
+
+/**
+ * This test measures the backing store usage of writing a block word by word, as keymap uploads do.
+ */
+TEST_F(WearLevelingWriteBack, WriteAmplification_BlockUpload) {
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> block;
+    std::iota(block.begin(), block.end(), 0x40);
+    for (size_t i = 0; i < block.size(); i += 2) {
+        EXPECT_NE(wear_leveling_write(i, &block[i], 2), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+    EXPECT_NE(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush returned incorrect status";
+    report("block_upload", block.size() / 2);
+
+    auto& inst = MockBackingStore::Instance();
+#ifdef WEAR_LEVELING_WRITE_BACK
+    EXPECT_EQ(inst.total_write_count(), (block.size() + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES) << "Words should have been merged into full log entries";
+#else
+    EXPECT_EQ(inst.total_write_count(), block.size() / 2) << "Every word should have been written";
+#endif
+
+    power_cycle();
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual{};
+    EXPECT_EQ(wear_leveling_read(0, actual.data(), actual.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(actual, ::testing::ElementsAreArray(block)) << "Invalid readback";
+}
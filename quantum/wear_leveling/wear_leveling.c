@@ -77,6 +77,18 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        During writes, with WEAR_LEVELING_WRITE_BACK:
+            * The cache is updated with the new data.
+            * The written range is recorded as dirty, merged with any dirty
+                range it overlaps or touches.
+            * If there is no room for another dirty range, the existing ones
+                are committed first.
+            * Dirty ranges are committed to the write log by
+                wear_leveling_flush(), which the caller invokes when idle,
+                before suspend, or after a timeout. Until then, a power loss
+                discards the buffered writes -- the backing store keeps the
+                data as of the previous commit.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -163,6 +175,13 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_WRITE_BACK
+    struct {
+        uint32_t start;
+        uint32_t end; // exclusive
+    } dirty[(WEAR_LEVELING_WRITE_BACK_RANGES)];
+    uint8_t dirty_count;
+#endif // WEAR_LEVELING_WRITE_BACK
 } wear_leveling;
 
 /**
@@ -204,6 +223,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_WRITE_BACK
+    wear_leveling.dirty_count = 0;
+#endif // WEAR_LEVELING_WRITE_BACK
 }
 
 /**
@@ -470,6 +492,47 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#ifdef WEAR_LEVELING_WRITE_BACK
+/**
+ * Records a range of the cache as not yet written to the backing store, merging it with any range it overlaps or touches.
+ * If there is no room for another range, the closest one is extended to cover it.
+ */
+static void wear_leveling_mark_dirty(uint32_t start, uint32_t end) {
+    uint8_t i = 0;
+    while (i < wear_leveling.dirty_count) {
+        if (start <= wear_leveling.dirty[i].end && end >= wear_leveling.dirty[i].start) {
+            // Absorb the existing range, and check the remaining ones again as the merged range may now touch them too
+            start                  = wear_leveling.dirty[i].start < start ? wear_leveling.dirty[i].start : start;
+            end                    = wear_leveling.dirty[i].end > end ? wear_leveling.dirty[i].end : end;
+            wear_leveling.dirty[i] = wear_leveling.dirty[--wear_leveling.dirty_count];
+            i                      = 0;
+            continue;
+        }
+        ++i;
+    }
+
+    if (wear_leveling.dirty_count >= (WEAR_LEVELING_WRITE_BACK_RANGES)) {
+        // Extending a range means the unchanged bytes in between get written again, only happens if a flush failed
+        uint8_t  closest  = 0;
+        uint32_t distance = UINT32_MAX;
+        for (i = 0; i < wear_leveling.dirty_count; ++i) {
+            uint32_t d = start > wear_leveling.dirty[i].end ? start - wear_leveling.dirty[i].end : wear_leveling.dirty[i].start - end;
+            if (d < distance) {
+                closest  = i;
+                distance = d;
+            }
+        }
+        wear_leveling.dirty[closest].start = wear_leveling.dirty[closest].start < start ? wear_leveling.dirty[closest].start : start;
+        wear_leveling.dirty[closest].end   = wear_leveling.dirty[closest].end > end ? wear_leveling.dirty[closest].end : end;
+        return;
+    }
+
+    wear_leveling.dirty[wear_leveling.dirty_count].start = start;
+    wear_leveling.dirty[wear_leveling.dirty_count].end   = end;
+    ++wear_leveling.dirty_count;
+}
+#endif // WEAR_LEVELING_WRITE_BACK
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -692,6 +755,22 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#ifdef WEAR_LEVELING_WRITE_BACK
+    // Out of dirty ranges -- commit the existing ones first
+    wear_leveling_status_t flush_status = WEAR_LEVELING_SUCCESS;
+    if (wear_leveling.dirty_count >= (WEAR_LEVELING_WRITE_BACK_RANGES)) {
+        flush_status = wear_leveling_flush();
+        if (flush_status == WEAR_LEVELING_CONSOLIDATED) {
+            // The whole cache, including this write, has been written to the consolidated area.
+            return flush_status;
+        }
+    }
+
+    // Defer the write to the backing store until the next flush
+    wear_leveling_mark_dirty(address, address + length);
+    return flush_status;
+#endif // WEAR_LEVELING_WRITE_BACK
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -727,6 +806,70 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Commits any dirty ranges of the cache to the write log.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+#ifdef WEAR_LEVELING_WRITE_BACK
+    if (wear_leveling.dirty_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush %d dirty ranges\n", (int)wear_leveling.dirty_count);
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Write each range out of the cache
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    while (wear_leveling.dirty_count > 0) {
+        const uint8_t  i     = wear_leveling.dirty_count - 1;
+        const uint32_t start = wear_leveling.dirty[i].start;
+        status               = wear_leveling_write_raw(start, &wear_leveling.cache[start], wear_leveling.dirty[i].end - start);
+        if (status == WEAR_LEVELING_FAILED) {
+            // Leave the range dirty so that the next flush retries it
+            break;
+        }
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            // The whole cache has been written to the consolidated area, nothing else needs to occur.
+            wear_leveling.dirty_count = 0;
+            break;
+        }
+        wear_leveling.dirty_count = i;
+    }
+
+    if (status == WEAR_LEVELING_SUCCESS) {
+        // Consolidate the cache + write log if required
+        status = wear_leveling_consolidate_if_needed();
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_WRITE_BACK
+}
+
+/**
+ * Whether any ranges of the cache have not been committed yet.
+ */
+bool wear_leveling_dirty(void) {
+#ifdef WEAR_LEVELING_WRITE_BACK
+    return wear_leveling.dirty_count > 0;
+#else
+    return false;
+#endif // WEAR_LEVELING_WRITE_BACK
+}
+
 /**
  * Reads logical data from the cache.
  */
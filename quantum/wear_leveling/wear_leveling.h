@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -52,3 +53,19 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Commits any writes buffered in the cache to the backing store.
+ *
+ * Only does anything if WEAR_LEVELING_WRITE_BACK is defined -- otherwise every write has already been committed.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Whether there are writes buffered in the cache which have not been committed to the backing store yet.
+ *
+ * @return true if wear_leveling_flush() needs to be invoked
+ */
+bool wear_leveling_dirty(void);
@@ -20,6 +20,7 @@
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "action_util.h"
+#include "task_scheduler.h"
 #include <math.h>
 
 // WPM Stuff
@@ -119,9 +120,13 @@ void update_wpm(uint16_t keycode) {
         period_presses[current_period]--;
     }
 #endif
+    task_schedule_in(SCHEDULED_TASK_WPM, 0);
 }
 
 void decay_wpm(void) {
+    // The estimate only moves on with the millisecond timer, or when a key is counted
+    task_schedule_in(SCHEDULED_TASK_WPM, 1);
+
     int32_t presses = period_presses[0];
     for (int i = 1; i <= periods; i++) {
         presses += period_presses[i];
@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// The benchmark generates its combos at runtime, see combo_count() and
+// combo_get() in test_combo_benchmark.cpp. This only satisfies introspection.
+uint16_t const placeholder_combo[] = {KC_NO, COMBO_END};
+
+combo_t key_combos[] = {COMBO(placeholder_combo, KC_NO)};
@@ -0,0 +1,189 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+
+namespace {
+
+const uint8_t  board_keys  = 30;
+const uint16_t combo_first = KC_F13;
+
+std::vector<std::vector<uint16_t>> combo_keys;
+std::vector<combo_t>               combos;
+size_t                             combo_get_calls = 0;
+
+uint16_t keycode_of(uint8_t key) {
+    return KC_A + key;
+}
+
+/*
+ * Generates `count` distinct combos over the 30 letter keys of the board.
+ * The first 420 combos are pairs of keys up to 14 columns apart, the
+ * remaining ones are triples.
+ */
+void generate_combos(uint16_t count) {
+    combo_keys.clear();
+    combos.clear();
+
+    for (uint16_t i = 0; i < count; i++) {
+        std::vector<uint16_t> keys;
+        if (i < board_keys * 14) {
+            const uint8_t first = i % board_keys;
+            keys                = {keycode_of(first), keycode_of((first + 1 + i / board_keys) % board_keys)};
+        } else {
+            const uint16_t j     = i - board_keys * 14;
+            const uint8_t  first = j % board_keys;
+            keys                 = {keycode_of(first), keycode_of((first + 1) % board_keys), keycode_of((first + 3 + j / board_keys) % board_keys)};
+        }
+        keys.push_back(COMBO_END);
+        combo_keys.push_back(keys);
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        combo_t combo = {};
+        combo.keys    = combo_keys[i].data();
+        combo.keycode = combo_first;
+        combos.push_back(combo);
+    }
+
+#ifdef COMBO_KEY_INDEX_LENGTH
+    combo_key_index_rebuild();
+#endif
+}
+
+size_t most_combos_per_key() {
+    size_t most = 0;
+    for (uint8_t key = 0; key < board_keys; key++) {
+        size_t n = std::count_if(combo_keys.begin(), combo_keys.end(), [key](const std::vector<uint16_t> &keys) { return std::find(keys.begin(), keys.end(), keycode_of(key)) != keys.end(); });
+        most     = std::max(most, n);
+    }
+    return most;
+}
+
+} // namespace
+
+extern "C" uint16_t combo_count(void) {
+    return combos.size();
+}
+
+extern "C" combo_t *combo_get(uint16_t combo_idx) {
+    combo_get_calls++;
+    return &combos[combo_idx];
+}
+
+class ComboBenchmark : public TestFixture {
+   protected:
+    void SetUp() override {
+        for (uint8_t key = 0; key < board_keys; key++) {
+            add_key({0, static_cast<uint8_t>(key % 10), static_cast<uint8_t>(key / 10), keycode_of(key)});
+        }
+    }
+
+    void TearDown() override {
+        generate_combos(0);
+    }
+
+    /* Taps every letter of the text, none of the taps completes a combo. */
+    void run(uint16_t count) {
+        TestDriver driver;
+        size_t     reports = 0;
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(InvokeWithoutArgs([&reports]() { reports++; }));
+
+        generate_combos(count);
+
+        const std::string     text = "sphinxofblackquartzjudgemyvowthequickbrownfoxjumpsoverthelazydog";
+        std::vector<uint64_t> samples;
+        size_t                calls  = 0;
+        size_t                events = 0;
+
+        for (char c : text) {
+            const uint8_t key = c - 'a';
+            KeymapKey     tap = {0, static_cast<uint8_t>(key % 10), static_cast<uint8_t>(key / 10), keycode_of(key)};
+            for (bool pressed : {true, false}) {
+                pressed ? tap.press() : tap.release();
+
+                combo_get_calls = 0;
+                auto start      = std::chrono::steady_clock::now();
+                keyboard_task();
+                auto end = std::chrono::steady_clock::now();
+                samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+                calls += combo_get_calls;
+                events++;
+
+                advance_time(1);
+            }
+        }
+
+        std::sort(samples.begin(), samples.end());
+        uint64_t sum = 0;
+        for (auto s : samples) {
+            sum += s;
+        }
+        const double calls_per_event = static_cast<double>(calls) / events;
+
+        std::cout << std::left << std::setw(8) << count << " combos:"
+                  << " events=" << events << " mean=" << sum / samples.size() << "ns"
+                  << " p50=" << samples[samples.size() / 2] << "ns"
+                  << " p99=" << samples[(samples.size() * 99) / 100] << "ns"
+                  << " combo_get/event=" << calls_per_event << std::endl;
+        RecordProperty("combos_" + std::to_string(count) + "_mean_ns", static_cast<int>(sum / samples.size()));
+
+        // a tap of a key which is not held together with others never triggers a combo
+        EXPECT_EQ(reports, events);
+
+#ifdef COMBO_KEY_INDEX_LENGTH
+        // pressing visits the combos of the key, releasing visits those and resets them again
+        EXPECT_LE(calls_per_event, 2.0 * most_combos_per_key());
+#else
+        EXPECT_GE(calls_per_event, count);
+#endif
+        VERIFY_AND_CLEAR(driver);
+    }
+};
+
+TEST_F(ComboBenchmark, Combos10) {
+    run(10);
+}
+
+TEST_F(ComboBenchmark, Combos100) {
+    run(100);
+}
+
+TEST_F(ComboBenchmark, Combos500) {
+    run(500);
+}
+
+TEST_F(ComboBenchmark, ComboStillTriggers) {
+    TestDriver driver;
+    generate_combos(500);
+
+    const uint8_t first_key  = combo_keys[42][0] - KC_A;
+    const uint8_t second_key = combo_keys[42][1] - KC_A;
+    KeymapKey     first      = {0, static_cast<uint8_t>(first_key % 10), static_cast<uint8_t>(first_key / 10), keycode_of(first_key)};
+    KeymapKey     second     = {0, static_cast<uint8_t>(second_key % 10), static_cast<uint8_t>(second_key / 10), keycode_of(second_key)};
+
+    EXPECT_REPORT(driver, (combo_first));
+    EXPECT_EMPTY_REPORT(driver);
+    first.press();
+    run_one_scan_loop();
+    second.press();
+    run_one_scan_loop();
+    first.release();
+    run_one_scan_loop();
+    second.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,5 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Same benchmark as combo_benchmark, built with COMBO_KEY_INDEX_LENGTH.
+#include "../combo_benchmark/test_combo_benchmark.cpp"
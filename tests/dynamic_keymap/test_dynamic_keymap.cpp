@@ -0,0 +1,175 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#include "nvm_dynamic_keymap.h"
+uint32_t eeprom_read_transaction_count(void);
+uint32_t eeprom_write_transaction_count(void);
+void     reset_eeprom_transaction_counts(void);
+}
+
+using testing::_;
+
+namespace {
+
+const uint16_t keymap_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+// The most VIA moves in one raw HID packet
+const uint16_t via_packet_size = 28;
+
+// Reads the keymap straight from storage, as stored
+std::vector<uint8_t> stored_keymap(void) {
+    std::vector<uint8_t> data(keymap_size);
+    nvm_dynamic_keymap_read_buffer(0, keymap_size, data.data());
+    return data;
+}
+
+// Sends the data in VIA sized packets, as a layout or macro upload does, and returns the number of packets
+uint32_t upload(void (*set_buffer)(uint16_t, uint16_t, uint8_t *), std::vector<uint8_t> &data) {
+    uint32_t packets = 0;
+    for (uint16_t offset = 0; offset < data.size(); offset += via_packet_size, packets++) {
+        uint16_t size = std::min<uint16_t>(via_packet_size, data.size() - offset);
+        set_buffer(offset, size, &data[offset]);
+    }
+    return packets;
+}
+
+std::vector<uint8_t> pattern(uint16_t size, uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = seed + i * 7;
+    }
+    return data;
+}
+
+} // namespace
+
+class DynamicKeymap : public TestFixture {};
+
+TEST_F(DynamicKeymap, PressPath_NoStorageReads) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_a});
+    dynamic_keymap_set_keycode(0, 0, 1, KC_B);
+    reset_eeprom_transaction_counts();
+
+    // A full walk of every layer, as a layer lookup does
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                keycode_at_keymap_location(layer, row, col);
+            }
+        }
+    }
+    EXPECT_EQ(keycode_at_keymap_location(0, 0, 1), KC_B);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(eeprom_read_transaction_count(), 0);
+}
+
+TEST_F(DynamicKeymap, Init_IsOneBulkRead) {
+    // Changed behind the mirror's back, as if by a previous boot
+    nvm_dynamic_keymap_update_keycode(1, 2, 3, KC_Z);
+    EXPECT_NE(dynamic_keymap_get_keycode(1, 2, 3), KC_Z);
+
+    reset_eeprom_transaction_counts();
+    dynamic_keymap_init();
+    EXPECT_EQ(eeprom_read_transaction_count(), 1);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_Z);
+}
+
+TEST_F(DynamicKeymap, SetKeycode_WritesThrough) {
+    dynamic_keymap_set_keycode(1, 3, MATRIX_COLS - 1, QK_MODS_MAX);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 3, MATRIX_COLS - 1), QK_MODS_MAX);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(1, 3, MATRIX_COLS - 1), QK_MODS_MAX);
+
+    // Out of range is ignored, and reads as KC_NO
+    dynamic_keymap_set_keycode(DYNAMIC_KEYMAP_LAYER_COUNT, 0, 0, KC_A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT, 0, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS, 0), KC_NO);
+}
+
+TEST_F(DynamicKeymap, SetBuffer_KeepsTheMirrorInStep) {
+    // Starts and ends halfway through a keycode, and runs past the end of the keymap
+    std::vector<uint8_t> data;
+    for (uint16_t i = 0; i < 41; i++) {
+        data.push_back(0x80 + i);
+    }
+    const uint16_t offset = keymap_size - 21;
+    dynamic_keymap_set_buffer(offset, data.size(), data.data());
+
+    std::vector<uint8_t> mirrored(keymap_size);
+    dynamic_keymap_get_buffer(0, keymap_size, mirrored.data());
+    EXPECT_EQ(mirrored, stored_keymap());
+    EXPECT_EQ(mirrored[offset], 0x80);
+    EXPECT_EQ(mirrored[keymap_size - 1], 0x80 + 20);
+
+    uint16_t last = (0x80 + 19) << 8 | (0x80 + 20);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), last);
+
+    // Past the end reads back as zero
+    std::vector<uint8_t> tail(4, 0xFF);
+    dynamic_keymap_get_buffer(keymap_size - 2, tail.size(), tail.data());
+    EXPECT_EQ(tail, (std::vector<uint8_t>{0x80 + 19, 0x80 + 20, 0, 0}));
+
+    dynamic_keymap_reset();
+    dynamic_keymap_get_buffer(0, keymap_size, mirrored.data());
+    EXPECT_EQ(mirrored, stored_keymap());
+}
+
+TEST_F(DynamicKeymap, LayoutUpload_OneTransactionPerPage) {
+    std::vector<uint8_t> layout = pattern(keymap_size, 0x11);
+    reset_eeprom_transaction_counts();
+    uint32_t packets = upload(dynamic_keymap_set_buffer, layout);
+    EXPECT_EQ(stored_keymap(), layout);
+
+    // Each packet is compared, and written, in at most two pieces where it crosses a page
+    uint32_t reads  = eeprom_read_transaction_count() - 1;
+    uint32_t writes = eeprom_write_transaction_count();
+    std::cout << "Layout upload of " << keymap_size << " bytes in " << packets << " packets: " << reads << " reads, " << writes << " writes" << std::endl;
+    EXPECT_GE(reads, packets);
+    EXPECT_LE(reads, 2 * packets);
+    EXPECT_LE(writes, reads);
+
+    // Uploading the same layout again only compares
+    reset_eeprom_transaction_counts();
+    upload(dynamic_keymap_set_buffer, layout);
+    EXPECT_LE(eeprom_read_transaction_count(), 2 * packets);
+    EXPECT_EQ(eeprom_write_transaction_count(), 0);
+}
+
+TEST_F(DynamicKeymap, MacroUpload_OneTransactionPerPage) {
+    uint16_t             macro_size = dynamic_keymap_macro_get_buffer_size();
+    std::vector<uint8_t> macros     = pattern(macro_size, 0x22);
+    reset_eeprom_transaction_counts();
+    uint32_t packets = upload(dynamic_keymap_macro_set_buffer, macros);
+    EXPECT_LE(eeprom_read_transaction_count(), 2 * packets);
+    EXPECT_LE(eeprom_write_transaction_count(), 2 * packets);
+
+    // Reading it back is one transaction per packet, and zeroes past the end
+    std::vector<uint8_t> read_back(packets * via_packet_size, 0xFF);
+    reset_eeprom_transaction_counts();
+    for (uint16_t offset = 0; offset < read_back.size(); offset += via_packet_size) {
+        dynamic_keymap_macro_get_buffer(offset, via_packet_size, &read_back[offset]);
+    }
+    EXPECT_EQ(eeprom_read_transaction_count(), packets);
+    EXPECT_EQ(std::vector<uint8_t>(read_back.begin(), read_back.begin() + macro_size), macros);
+    EXPECT_EQ(std::vector<uint8_t>(read_back.begin() + macro_size, read_back.end()), std::vector<uint8_t>(read_back.size() - macro_size, 0));
+
+    dynamic_keymap_macro_reset();
+    std::vector<uint8_t> cleared(macro_size, 0xFF);
+    dynamic_keymap_macro_get_buffer(0, macro_size, cleared.data());
+    EXPECT_EQ(cleared, std::vector<uint8_t>(macro_size, 0));
+}
@@ -0,0 +1,23 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { jk_escape, df_tab };
+
+uint16_t const jk_combo[] = {KC_J, KC_K, COMBO_END};
+uint16_t const df_combo[] = {KC_D, KC_F, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [jk_escape] = COMBO(jk_combo, KC_ESCAPE),
+    [df_tab]    = COMBO(df_combo, KC_TAB)
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    [0] = ACTION_TAP_DANCE_DOUBLE(KC_SEMICOLON, KC_ESCAPE)
+};
+// clang-format on
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE);
+
+const key_override_t *key_overrides[] = {&delete_key_override};
@@ -0,0 +1,154 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "latency_probe.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+
+LatencyProbe* LatencyProbe::active = nullptr;
+
+void LatencyHistogram::add(uint64_t sample_ns) {
+    m_samples.push_back(sample_ns);
+    m_sorted = false;
+}
+
+size_t LatencyHistogram::count() const {
+    return m_samples.size();
+}
+
+void LatencyHistogram::sort() const {
+    if (!m_sorted) {
+        std::sort(m_samples.begin(), m_samples.end());
+        m_sorted = true;
+    }
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    if (m_samples.empty()) {
+        return 0;
+    }
+    sort();
+    size_t index = static_cast<size_t>(p / 100.0 * (m_samples.size() - 1) + 0.5);
+    return m_samples[std::min(index, m_samples.size() - 1)];
+}
+
+uint64_t LatencyHistogram::min() const {
+    return percentile(0);
+}
+
+uint64_t LatencyHistogram::max() const {
+    return percentile(100);
+}
+
+uint64_t LatencyHistogram::mean() const {
+    if (m_samples.empty()) {
+        return 0;
+    }
+    return std::accumulate(m_samples.begin(), m_samples.end(), uint64_t{0}) / m_samples.size();
+}
+
+void LatencyHistogram::dump(std::ostream& os) const {
+    os << "  " << std::left << std::setw(8) << m_name << std::right << " n=" << std::setw(5) << count() << "  min=" << std::setw(7) << min() << "  avg=" << std::setw(7) << mean() << "  p50=" << std::setw(7) << percentile(50) << "  p90=" << std::setw(7) << percentile(90) << "  p99=" << std::setw(7) << percentile(99) << "  max=" << std::setw(8) << max() << " ns" << std::endl;
+
+    if (m_samples.empty()) {
+        return;
+    }
+
+    // log2 buckets, starting at 128ns so that the noise floor is folded into one row
+    std::vector<size_t> buckets(24, 0);
+    for (uint64_t sample : m_samples) {
+        size_t bucket = 0;
+        while (bucket + 1 < buckets.size() && sample >= (uint64_t{128} << bucket)) {
+            bucket++;
+        }
+        buckets[bucket]++;
+    }
+
+    const size_t widest = *std::max_element(buckets.begin(), buckets.end());
+    for (size_t bucket = 0; bucket < buckets.size(); bucket++) {
+        if (buckets[bucket] == 0) {
+            continue;
+        }
+        const size_t bar = (buckets[bucket] * 40 + widest - 1) / widest;
+        os << "    < " << std::setw(9) << (uint64_t{128} << bucket) << " ns " << std::setw(5) << buckets[bucket] << " " << std::string(bar, '#') << std::endl;
+    }
+}
+
+LatencyProbe::LatencyProbe() : m_scan("scan"), m_process("process"), m_total("total"), m_event("event"), m_idle("idle") {}
+
+uint64_t LatencyProbe::elapsed_ns(clock::time_point from, clock::time_point to) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+}
+
+void LatencyProbe::begin_loop(unsigned matrix_events, uint32_t now_ms) {
+    m_matrix_events = matrix_events;
+    m_record_seen   = false;
+    m_report_seen   = false;
+    if (matrix_events) {
+        m_last_change_ms = now_ms;
+    }
+    m_loop_start = clock::now();
+}
+
+void LatencyProbe::end_loop() {
+    const uint64_t loop_ns = elapsed_ns(m_loop_start, clock::now());
+    if (m_matrix_events) {
+        m_event.add(loop_ns / m_matrix_events);
+    } else {
+        m_idle.add(loop_ns);
+    }
+}
+
+void LatencyProbe::on_record() {
+    if (m_record_seen) {
+        return;
+    }
+    m_record_seen  = true;
+    m_record_start = clock::now();
+    m_scan.add(elapsed_ns(m_loop_start, m_record_start));
+}
+
+void LatencyProbe::on_report(uint32_t now_ms) {
+    const auto now = clock::now();
+    m_reports++;
+
+    const uint32_t simulated_ms = now_ms - m_last_change_ms;
+    m_simulated_ms.push_back(simulated_ms);
+    m_max_simulated_ms = std::max(m_max_simulated_ms, simulated_ms);
+
+    if (m_report_seen) {
+        return;
+    }
+    m_report_seen = true;
+    if (m_record_seen) {
+        m_process.add(elapsed_ns(m_record_start, now));
+    }
+    m_total.add(elapsed_ns(m_loop_start, now));
+}
+
+void LatencyProbe::dump(std::ostream& os, const std::string& scenario) const {
+    os << "[ LATENCY  ] " << scenario << ": " << m_reports << " reports, " << m_event.count() << " matrix loops, " << m_idle.count() << " idle loops" << std::endl;
+    m_scan.dump(os);
+    m_process.dump(os);
+    m_total.dump(os);
+    m_event.dump(os);
+    m_idle.dump(os);
+
+    std::vector<size_t> simulated(12, 0);
+    for (uint32_t ms : m_simulated_ms) {
+        size_t bucket = 0;
+        while (bucket + 1 < simulated.size() && ms >= (1u << bucket)) {
+            bucket++;
+        }
+        simulated[bucket]++;
+    }
+    os << "  simulated change-to-report latency:";
+    for (size_t bucket = 0; bucket < simulated.size(); bucket++) {
+        if (simulated[bucket]) {
+            os << " <" << (1u << bucket) << "ms:" << simulated[bucket];
+        }
+    }
+    os << " (max " << m_max_simulated_ms << "ms)" << std::endl;
+}
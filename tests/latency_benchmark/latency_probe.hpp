@@ -0,0 +1,93 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Collects wall-clock samples in nanoseconds and summarises them as
+ * percentiles and a log2 bucketed histogram.
+ */
+class LatencyHistogram {
+   public:
+    explicit LatencyHistogram(std::string name) : m_name(std::move(name)) {}
+
+    void     add(uint64_t sample_ns);
+    size_t   count() const;
+    uint64_t percentile(double p) const;
+    uint64_t min() const;
+    uint64_t max() const;
+    uint64_t mean() const;
+
+    void dump(std::ostream& os) const;
+
+   private:
+    std::string                   m_name;
+    mutable std::vector<uint64_t> m_samples;
+    mutable bool                  m_sorted = true;
+
+    void sort() const;
+};
+
+/**
+ * @brief Timestamps the stages a key event passes through inside one
+ * `keyboard_task()` iteration.
+ *
+ * Stages measured (all host wall-clock):
+ *  - scan:    loop start until the event enters `pre_process_record_quantum`
+ *  - process: `pre_process_record_quantum` until the first keyboard report
+ *  - total:   loop start until the first keyboard report
+ *  - event:   full `keyboard_task()` cost divided by the matrix events it handled
+ *  - idle:    full `keyboard_task()` cost of iterations without matrix events
+ *
+ * Additionally the simulated time (platforms/test/timer.c) between the last
+ * matrix change and each report is kept, which exposes the intentional delays
+ * introduced by combos, tap-hold and tap dance.
+ */
+class LatencyProbe {
+    using clock = std::chrono::steady_clock;
+
+   public:
+    LatencyProbe();
+
+    void begin_loop(unsigned matrix_events, uint32_t now_ms);
+    void end_loop();
+    void on_record();
+    void on_report(uint32_t now_ms);
+
+    size_t reports() const {
+        return m_reports;
+    }
+    uint32_t max_simulated_latency_ms() const {
+        return m_max_simulated_ms;
+    }
+
+    void dump(std::ostream& os, const std::string& scenario) const;
+
+    static LatencyProbe* active;
+
+   private:
+    LatencyHistogram m_scan;
+    LatencyHistogram m_process;
+    LatencyHistogram m_total;
+    LatencyHistogram m_event;
+    LatencyHistogram m_idle;
+
+    std::vector<uint32_t> m_simulated_ms;
+
+    clock::time_point m_loop_start;
+    clock::time_point m_record_start;
+    bool              m_record_seen    = false;
+    bool              m_report_seen    = false;
+    unsigned          m_matrix_events  = 0;
+    uint32_t          m_last_change_ms = 0;
+    size_t            m_reports        = 0;
+    uint32_t          m_max_simulated_ms = 0;
+
+    static uint64_t elapsed_ns(clock::time_point from, clock::time_point to);
+};
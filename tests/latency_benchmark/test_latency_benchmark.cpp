@@ -0,0 +1,258 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include <map>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "latency_probe.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+
+extern "C" bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (LatencyProbe::active) {
+        LatencyProbe::active->on_record();
+    }
+    return true;
+}
+
+namespace {
+
+struct TraceEvent {
+    uint32_t at_ms;
+    char     key;
+    bool     pressed;
+};
+
+// Inter-press intervals and hold durations captured from a ~75 WPM typist.
+// Intervals shorter than the previous hold produce key rollover.
+// clang-format off
+const uint16_t recorded_intervals_ms[] = {142, 98, 121, 87, 165, 110, 76, 133, 104, 92, 150, 118, 84, 127, 101, 139, 95, 112, 70, 158};
+const uint16_t recorded_holds_ms[]     = { 88, 95,  72, 104, 81,  99, 110, 77, 93, 86, 102, 79, 115, 83, 91};
+// clang-format on
+
+/**
+ * @brief Builds a timed press/release trace from a text.
+ *
+ * Besides plain characters the text knows the following markers:
+ *  - `^` holds shift around the next key
+ *  - `<` is a backspace
+ *  - `(..)` presses the enclosed keys as a chord within a few milliseconds
+ */
+std::vector<TraceEvent> build_trace(const std::string &text) {
+    std::vector<TraceEvent> trace;
+    uint32_t                now     = 0;
+    size_t                  stroke  = 0;
+    bool                    shifted = false;
+
+    auto hold_for = [&]() { return recorded_holds_ms[stroke % (sizeof(recorded_holds_ms) / sizeof(recorded_holds_ms[0]))]; };
+    auto next     = [&]() { now += recorded_intervals_ms[stroke++ % (sizeof(recorded_intervals_ms) / sizeof(recorded_intervals_ms[0]))]; };
+
+    for (size_t i = 0; i < text.size(); i++) {
+        char key = text[i];
+        if (key == '^') {
+            shifted = true;
+            continue;
+        }
+        if (key == '(') {
+            size_t   end   = text.find(')', i);
+            uint32_t press = now;
+            for (size_t k = i + 1; k < end; k++) {
+                trace.push_back({press, text[k], true});
+                press += 4;
+            }
+            for (size_t k = i + 1; k < end; k++) {
+                trace.push_back({press + hold_for(), text[k], false});
+            }
+            i = end;
+            next();
+            continue;
+        }
+
+        const uint32_t hold = hold_for();
+        if (shifted) {
+            trace.push_back({now, 'S', true});
+            trace.push_back({now + 40, key, true});
+            trace.push_back({now + 40 + hold, key, false});
+            trace.push_back({now + 60 + hold, 'S', false});
+            now += 60;
+            shifted = false;
+        } else {
+            trace.push_back({now, key, true});
+            trace.push_back({now + hold, key, false});
+        }
+        next();
+    }
+
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent &a, const TraceEvent &b) { return a.at_ms < b.at_ms; });
+    return trace;
+}
+
+const std::string typing_trace = "the quick brown fox^<<jumps over (jk)the lazy dog;; (df)sphinx of black quartz, judge my vow. ";
+
+} // namespace
+
+class LatencyBenchmark : public TestFixture {
+   protected:
+    /* Keymap layout: the three letter rows of a 40% board plus shift, space and backspace. */
+    void load_layout(std::map<char, uint16_t> overrides) {
+        const char *rows[] = {"qwertyuiop", "asdfghjkl;", "zxcvbnm,./"};
+        std::map<char, uint16_t> base = {
+            {'q', KC_Q}, {'w', KC_W}, {'e', KC_E}, {'r', KC_R}, {'t', KC_T}, {'y', KC_Y}, {'u', KC_U}, {'i', KC_I}, {'o', KC_O}, {'p', KC_P},
+            {'a', KC_A}, {'s', KC_S}, {'d', KC_D}, {'f', KC_F}, {'g', KC_G}, {'h', KC_H}, {'j', KC_J}, {'k', KC_K}, {'l', KC_L}, {';', KC_SEMICOLON},
+            {'z', KC_Z}, {'x', KC_X}, {'c', KC_C}, {'v', KC_V}, {'b', KC_B}, {'n', KC_N}, {'m', KC_M}, {',', KC_COMMA}, {'.', KC_DOT}, {'/', KC_SLASH},
+        };
+        for (auto &entry : overrides) {
+            base[entry.first] = entry.second;
+        }
+
+        keymap.clear();
+        positions.clear();
+        for (uint8_t row = 0; row < 3; row++) {
+            for (uint8_t col = 0; col < 10; col++) {
+                const char key = rows[row][col];
+                add_key({0, col, row, base[key]});
+                positions[key] = {.col = col, .row = row};
+            }
+        }
+        const char extra[] = {'S', ' ', '<'};
+        for (uint8_t col = 0; col < 10; col++) {
+            uint16_t keycode = KC_NO;
+            if (col < sizeof(extra)) {
+                keycode                = (extra[col] == 'S') ? KC_LEFT_SHIFT : (extra[col] == ' ') ? KC_SPACE : KC_BACKSPACE;
+                positions[extra[col]] = {.col = col, .row = 3};
+            }
+            add_key({0, col, 3, keycode});
+        }
+    }
+
+    /* Replays the trace one simulated millisecond per keyboard_task() iteration. */
+    void replay(const std::vector<TraceEvent> &trace, LatencyProbe &probe) {
+        TestDriver driver;
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(InvokeWithoutArgs([&probe]() { probe.on_report(timer_read32()); }));
+
+        LatencyProbe::active = &probe;
+
+        const uint32_t end  = trace.back().at_ms + TAPPING_TERM * 2;
+        size_t         next = 0;
+        for (uint32_t now = 0; now <= end; now++) {
+            unsigned matrix_events = 0;
+            for (; next < trace.size() && trace[next].at_ms == now; next++) {
+                const keypos_t pos = positions.at(trace[next].key);
+                if (trace[next].pressed) {
+                    press_key(pos.col, pos.row);
+                } else {
+                    release_key(pos.col, pos.row);
+                }
+                matrix_events++;
+            }
+
+            probe.begin_loop(matrix_events, timer_read32());
+            keyboard_task();
+            probe.end_loop();
+            housekeeping_task();
+            advance_time(1);
+        }
+
+        LatencyProbe::active = nullptr;
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    void run_scenario(const std::string &name, LatencyProbe &probe) {
+        const auto trace = build_trace(typing_trace);
+        replay(trace, probe);
+        probe.dump(std::cout, name);
+        RecordProperty(name + "_reports", static_cast<int>(probe.reports()));
+    }
+
+    void SetUp() override {
+        combo_disable();
+        key_override_off();
+    }
+
+    void TearDown() override {
+        combo_enable();
+        key_override_on();
+    }
+
+    std::map<char, keypos_t> positions;
+};
+
+TEST_F(LatencyBenchmark, Baseline) {
+    LatencyProbe probe;
+    load_layout({});
+    run_scenario("baseline", probe);
+
+    // Every press and release changes the report and nothing is held back.
+    EXPECT_EQ(probe.reports(), build_trace(typing_trace).size());
+    EXPECT_EQ(probe.max_simulated_latency_ms(), 0);
+}
+
+TEST_F(LatencyBenchmark, Combos) {
+    LatencyProbe probe;
+    load_layout({});
+    combo_enable();
+    run_scenario("combos", probe);
+
+    EXPECT_GT(probe.reports(), 0);
+    // The combo timer expires on the first scan after COMBO_TERM has elapsed.
+    EXPECT_LE(probe.max_simulated_latency_ms(), COMBO_TERM + 1);
+}
+
+TEST_F(LatencyBenchmark, TapHold) {
+    LatencyProbe probe;
+    load_layout({
+        {'a', LSFT_T(KC_A)},
+        {'s', LCTL_T(KC_S)},
+        {'d', LALT_T(KC_D)},
+        {'f', LGUI_T(KC_F)},
+        {'j', RGUI_T(KC_J)},
+        {'k', RALT_T(KC_K)},
+        {'l', RCTL_T(KC_L)},
+    });
+    run_scenario("tap_hold", probe);
+
+    EXPECT_GT(probe.reports(), 0);
+    EXPECT_LE(probe.max_simulated_latency_ms(), TAPPING_TERM);
+}
+
+TEST_F(LatencyBenchmark, TapDance) {
+    LatencyProbe probe;
+    load_layout({{';', TD(0)}});
+    run_scenario("tap_dance", probe);
+
+    EXPECT_GT(probe.reports(), 0);
+    EXPECT_LE(probe.max_simulated_latency_ms(), TAPPING_TERM);
+}
+
+TEST_F(LatencyBenchmark, KeyOverrides) {
+    LatencyProbe probe;
+    load_layout({});
+    key_override_on();
+    run_scenario("key_override", probe);
+
+    EXPECT_GT(probe.reports(), 0);
+    EXPECT_LE(probe.max_simulated_latency_ms(), 0);
+}
+
+TEST_F(LatencyBenchmark, AllFeatures) {
+    LatencyProbe probe;
+    load_layout({
+        {'a', LSFT_T(KC_A)},
+        {'s', LCTL_T(KC_S)},
+        {'l', RCTL_T(KC_L)},
+        {';', TD(0)},
+    });
+    combo_enable();
+    key_override_on();
+    run_scenario("all_features", probe);
+
+    EXPECT_GT(probe.reports(), 0);
+    EXPECT_LE(probe.max_simulated_latency_ms(), TAPPING_TERM);
+}
@@ -0,0 +1,125 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerLookupCache : public TestFixture {
+   protected:
+    /* Replaces a keymap entry without notifying the cache, like a keymap stored outside of QMK would. */
+    void overwrite_key_silently(uint8_t layer, keypos_t position, uint16_t keycode) {
+        std::vector<KeymapKey> updated;
+        for (const auto &key : keymap) {
+            if (key.layer == layer && key.position.col == position.col && key.position.row == position.row) {
+                updated.push_back(KeymapKey(layer, position.col, position.row, keycode));
+            } else {
+                updated.push_back(key);
+            }
+        }
+        keymap.swap(updated);
+    }
+};
+
+TEST_F(LayerLookupCache, ResolvesThroughTransparentLayers) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(2, 0, 0, KC_TRNS), KeymapKey(3, 0, 0, KC_TRNS)});
+    layer_state_set(0b1110);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+}
+
+TEST_F(LayerLookupCache, LayerChangeAboveResolvedLayerRefreshes) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(2, 0, 0, KC_B);
+
+    set_keymap({key_a, KeymapKey(1, 0, 0, KC_TRNS), key_b});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 2);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_off(2);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+}
+
+TEST_F(LayerLookupCache, LayerChangeBelowResolvedLayerKeepsEntry) {
+    TestDriver driver;
+    keypos_t   position = {.col = 0, .row = 0};
+
+    set_keymap({KeymapKey(0, 0, 0, KC_A), KeymapKey(1, 0, 0, KC_B), KeymapKey(2, 0, 0, KC_C), KeymapKey(3, 0, 0, KC_TRNS)});
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(position), 2);
+
+    overwrite_key_silently(2, position, KC_TRNS);
+
+    // Layer 1 is below the resolved layer, the entry is still served from the cache.
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(position), 2);
+
+    // Layer 3 is above it, so the key is resolved again.
+    layer_on(3);
+    EXPECT_EQ(layer_switch_get_layer(position), 1);
+}
+
+TEST_F(LayerLookupCache, KeymapChangeNeedsClear) {
+    TestDriver driver;
+    keypos_t   position = {.col = 1, .row = 0};
+
+    set_keymap({KeymapKey(0, 1, 0, KC_A), KeymapKey(1, 1, 0, KC_TRNS)});
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(position), 0);
+
+    overwrite_key_silently(1, position, KC_B);
+    EXPECT_EQ(layer_switch_get_layer(position), 0);
+
+    layer_lookup_cache_clear_key(position);
+    EXPECT_EQ(layer_switch_get_layer(position), 1);
+
+    overwrite_key_silently(1, position, KC_TRNS);
+    layer_lookup_cache_clear();
+    EXPECT_EQ(layer_switch_get_layer(position), 0);
+}
+
+TEST_F(LayerLookupCache, DirectLayerStateWriteIsPickedUp) {
+    TestDriver driver;
+    keypos_t   position = {.col = 0, .row = 0};
+
+    set_keymap({KeymapKey(0, 0, 0, KC_A), KeymapKey(4, 0, 0, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(position), 0);
+
+    // e.g. the split transport writes the state of the master side directly
+    layer_state = (layer_state_t)1 << 4;
+    EXPECT_EQ(layer_switch_get_layer(position), 4);
+
+    layer_state = 0;
+    EXPECT_EQ(layer_switch_get_layer(position), 0);
+}
@@ -0,0 +1,162 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::Invoke;
+
+struct MotionTotals {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+};
+
+class PointingAccumulate : public TestFixture {
+   protected:
+    PointingAccumulate() {
+        pointing_device_set_motion_scale(POINTING_DEVICE_MOTION_SCALE_UNIT);
+    }
+
+    // Stands in for a sensor read many times per scan, returning fresh motion on every read
+    void sample_at_rate(unsigned ms, unsigned samples_per_ms, int16_t max_xy, int16_t max_hv) {
+        std::uniform_int_distribution<int16_t> xy(-max_xy, max_xy);
+        std::uniform_int_distribution<int16_t> hv(-max_hv, max_hv);
+        for (unsigned t = 0; t < ms; t++) {
+            for (unsigned i = 0; i < samples_per_ms; i++) {
+                int16_t x = xy(rng), y = xy(rng), h = hv(rng), v = hv(rng);
+                pd_set_x(x);
+                pd_set_y(y);
+                pd_set_h(h);
+                pd_set_v(v);
+                generated.x += x;
+                generated.y += y;
+                generated.h += h;
+                generated.v += v;
+                pointing_device_sample();
+            }
+            pd_clear_movement();
+            run_one_scan_loop();
+        }
+    }
+
+    // Records every report sent, so the totals can be compared with what the sensor produced
+    void record_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) {
+            sent.x += report.x;
+            sent.y += report.y;
+            sent.h += report.h;
+            sent.v += report.v;
+            report_times.push_back(timer_read());
+        }));
+    }
+
+    std::mt19937          rng{4321};
+    MotionTotals          generated = {};
+    MotionTotals          sent      = {};
+    std::vector<uint16_t> report_times;
+};
+
+TEST_F(PointingAccumulate, HighRateSensor_NoMotionLost) {
+    TestDriver driver;
+    record_reports(driver);
+
+    // 8kHz sensor, fast enough that most intervals overflow the report range
+    sample_at_rate(500, 8, 60, 20);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(sent.x, generated.x);
+    EXPECT_EQ(sent.y, generated.y);
+    EXPECT_EQ(sent.h, generated.h);
+    EXPECT_EQ(sent.v, generated.v);
+}
+
+TEST_F(PointingAccumulate, HighRateSensor_OneReportPerInterval) {
+    TestDriver driver;
+    record_reports(driver);
+
+    sample_at_rate(200, 8, 10, 0);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_GT(report_times.size(), 1);
+    EXPECT_LE(report_times.size(), 300 / POINTING_DEVICE_REPORT_INTERVAL_MS + 1);
+    for (size_t i = 1; i < report_times.size(); i++) {
+        EXPECT_GE(TIMER_DIFF_16(report_times[i], report_times[i - 1]), POINTING_DEVICE_REPORT_INTERVAL_MS) << "Reports " << i - 1 << " and " << i;
+    }
+    EXPECT_EQ(sent.x, generated.x);
+    EXPECT_EQ(sent.y, generated.y);
+}
+
+TEST_F(PointingAccumulate, LargeMotion_SpreadAcrossReports) {
+    TestDriver driver;
+    testing::InSequence s;
+
+    // Each read is in range, their sum is not
+    pd_set_x(100);
+    pd_set_y(-100);
+    for (int i = 0; i < 3; i++) {
+        pointing_device_sample();
+    }
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, MOUSE_REPORT_XY_MIN, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, MOUSE_REPORT_XY_MIN, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (300 - 2 * MOUSE_REPORT_XY_MAX, -300 - 2 * MOUSE_REPORT_XY_MIN, 0, 0, 0));
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 4);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, SubCountMotion_IsCarried) {
+    TestDriver driver;
+    record_reports(driver);
+    pointing_device_set_motion_scale(POINTING_DEVICE_MOTION_SCALE_UNIT / 4);
+
+    // Ten counts at a quarter scale is two and a half counts, the half has to wait for more motion
+    sample_at_rate(POINTING_DEVICE_REPORT_INTERVAL_MS * 2, 5, 0, 0);
+    pd_set_x(10);
+    pd_set_v(-10);
+    pointing_device_sample();
+    pd_clear_movement();
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 2);
+    EXPECT_EQ(sent.x, 2);
+    EXPECT_EQ(sent.v, -2);
+
+    pd_set_x(2);
+    pd_set_v(-2);
+    pointing_device_sample();
+    pd_clear_movement();
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 2);
+    EXPECT_EQ(sent.x, 3);
+    EXPECT_EQ(sent.v, -3);
+    VERIFY_AND_CLEAR(driver);
+
+    pointing_device_set_motion_scale(POINTING_DEVICE_MOTION_SCALE_UNIT);
+}
+
+TEST_F(PointingAccumulate, Buttons_FollowTheLatestSample) {
+    TestDriver driver;
+    testing::InSequence s;
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    pd_set_x(5);
+    pointing_device_sample();
+    pd_set_x(7);
+    pointing_device_sample();
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (12, 0, 0, 0, 1));
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 0));
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
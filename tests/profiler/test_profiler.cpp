@@ -0,0 +1,169 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiler.h"
+}
+
+using testing::_;
+
+class Profiler : public TestFixture {
+   protected:
+    uint8_t find_zone(const char *name) {
+        profiler_zone_stats_t stats;
+        for (uint8_t i = 0; i < profiler_zone_count(); i++) {
+            profiler_get_zone_stats(i, &stats);
+            if (strcmp(stats.name, name) == 0) {
+                return i;
+            }
+        }
+        return PROFILER_ZONE_UNREGISTERED;
+    }
+};
+
+TEST_F(Profiler, KeyboardTaskZonesAreNested) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    run_one_scan_loop();
+    profiler_reset();
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    const uint8_t keyboard_task = find_zone("keyboard_task");
+    const uint8_t matrix_task   = find_zone("matrix_task");
+    const uint8_t quantum_task  = find_zone("quantum_task");
+    ASSERT_NE(keyboard_task, PROFILER_ZONE_UNREGISTERED);
+    ASSERT_NE(matrix_task, PROFILER_ZONE_UNREGISTERED);
+    ASSERT_NE(quantum_task, PROFILER_ZONE_UNREGISTERED);
+
+    profiler_zone_stats_t stats;
+    profiler_get_zone_stats(keyboard_task, &stats);
+    EXPECT_EQ(stats.parent, PROFILER_ZONE_UNREGISTERED);
+    EXPECT_EQ(stats.depth, 0);
+    EXPECT_EQ(stats.count, 10);
+    EXPECT_LE(stats.min, stats.avg);
+    EXPECT_LE(stats.avg, stats.max);
+    EXPECT_LE(stats.p99, stats.max);
+    EXPECT_GE(stats.p99, stats.min);
+
+    const uint32_t keyboard_task_max = stats.max;
+
+    profiler_get_zone_stats(matrix_task, &stats);
+    EXPECT_EQ(stats.parent, keyboard_task);
+    EXPECT_EQ(stats.depth, 1);
+    EXPECT_EQ(stats.count, 10);
+    EXPECT_LE(stats.max, keyboard_task_max);
+
+    profiler_get_zone_stats(quantum_task, &stats);
+    EXPECT_EQ(stats.parent, keyboard_task);
+    EXPECT_EQ(stats.count, 10);
+
+    EXPECT_REPORT(driver, ());
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Profiler, UserZonesNestUnderTheOpenZone) {
+    TestDriver driver;
+    profiler_reset();
+    for (int i = 0; i < 3; i++) {
+        PROFILER_ZONE_BEGIN("outer");
+        PROFILER_ZONE_CALL("inner", run_one_scan_loop());
+        PROFILER_ZONE_END();
+    }
+
+    const uint8_t outer = find_zone("outer");
+    const uint8_t inner = find_zone("inner");
+    ASSERT_NE(outer, PROFILER_ZONE_UNREGISTERED);
+    ASSERT_NE(inner, PROFILER_ZONE_UNREGISTERED);
+
+    profiler_zone_stats_t stats;
+    profiler_get_zone_stats(inner, &stats);
+    EXPECT_EQ(stats.parent, outer);
+    EXPECT_EQ(stats.count, 3);
+
+    profiler_get_zone_stats(find_zone("keyboard_task"), &stats);
+    EXPECT_EQ(stats.parent, PROFILER_ZONE_UNREGISTERED);
+    EXPECT_EQ(stats.count, 3);
+}
+
+TEST_F(Profiler, ResetClearsStatistics) {
+    TestDriver driver;
+    run_one_scan_loop();
+    profiler_reset();
+
+    profiler_zone_stats_t stats;
+    ASSERT_TRUE(profiler_get_zone_stats(find_zone("keyboard_task"), &stats));
+    EXPECT_EQ(stats.count, 0);
+    EXPECT_EQ(stats.min, 0);
+    EXPECT_EQ(stats.max, 0);
+    EXPECT_EQ(stats.p99, 0);
+
+    EXPECT_FALSE(profiler_get_zone_stats(profiler_zone_count(), &stats));
+}
+
+TEST_F(Profiler, ZonePacket) {
+    TestDriver driver;
+    profiler_reset();
+    idle_for(20);
+
+    const uint8_t zone = find_zone("matrix_task");
+    uint8_t       packet[32];
+    ASSERT_TRUE(profiler_get_zone_packet(zone, packet, sizeof(packet)));
+
+    profiler_zone_stats_t stats;
+    profiler_get_zone_stats(zone, &stats);
+
+    EXPECT_EQ(packet[0], PROFILER_RAW_HID_MARKER);
+    EXPECT_EQ(packet[1], zone);
+    EXPECT_EQ(packet[2], stats.parent);
+    EXPECT_EQ(packet[3], stats.depth);
+    EXPECT_EQ(packet[4] | packet[5] << 8 | packet[6] << 16 | packet[7] << 24, 20);
+    EXPECT_EQ(0, memcmp(&packet[24], "matrix_t", 8));
+
+    EXPECT_FALSE(profiler_get_zone_packet(profiler_zone_count(), packet, sizeof(packet)));
+}
+
+TEST_F(Profiler, ZonesBeyondMaxDepthAreCountedNotRecorded) {
+    TestDriver driver;
+    profiler_reset();
+
+    // One scan opens keyboard_task and its sub-tasks, nest them below the maximum depth
+    for (uint8_t i = 0; i < PROFILER_MAX_DEPTH - 1; i++) {
+        PROFILER_ZONE_BEGIN("deep");
+    }
+    run_one_scan_loop();
+    PROFILER_ZONE_CALL("too deep", (void)0);
+    for (uint8_t i = 0; i < PROFILER_MAX_DEPTH - 1; i++) {
+        PROFILER_ZONE_END();
+    }
+
+    profiler_zone_stats_t stats;
+    for (uint8_t i = 0; i < profiler_zone_count(); i++) {
+        profiler_get_zone_stats(i, &stats);
+        EXPECT_LT(stats.depth, PROFILER_MAX_DEPTH) << stats.name;
+        if (stats.parent != PROFILER_ZONE_UNREGISTERED) {
+            EXPECT_LT(stats.parent, profiler_zone_count()) << stats.name;
+        }
+    }
+    EXPECT_GT(profiler_depth_overflows(), 0);
+
+    // Zones opened at the maximum depth were balanced, later ones nest correctly again
+    PROFILER_ZONE_CALL("after", (void)0);
+    const uint8_t after = find_zone("after");
+    ASSERT_NE(after, PROFILER_ZONE_UNREGISTERED);
+    profiler_get_zone_stats(after, &stats);
+    EXPECT_EQ(stats.parent, PROFILER_ZONE_UNREGISTERED);
+    EXPECT_EQ(stats.depth, 0);
+    EXPECT_EQ(stats.count, 1);
+}
@@ -0,0 +1,255 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+using testing::Invoke;
+
+enum {
+    TAP_A = SAFE_RANGE,
+    SHIFTED_B,
+    RELEASE_SHIFTED_B,
+    SLOW_TAP_C,
+    SLOW_TAP_SHIFTED_C,
+    SHIFT_CLICK,
+    SHIFT_VOLUME_UP,
+};
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    if (!record->event.pressed) {
+        return true;
+    }
+
+    switch (keycode) {
+        case TAP_A:
+            tap_code(KC_A);
+            return false;
+        case SHIFTED_B:
+            register_code(KC_LSFT);
+            register_code(KC_B);
+            return false;
+        case RELEASE_SHIFTED_B:
+            unregister_code(KC_B);
+            unregister_code(KC_LSFT);
+            return false;
+        case SLOW_TAP_C:
+            tap_code_delay(KC_C, 20);
+            return false;
+        case SLOW_TAP_SHIFTED_C:
+            tap_code16_delay(LSFT(KC_C), 20);
+            return false;
+        case SHIFT_CLICK: {
+            report_mouse_t report = {.buttons = 1};
+            register_code(KC_LSFT);
+            host_mouse_send(&report);
+            return false;
+        }
+        case SHIFT_VOLUME_UP:
+            register_code(KC_LSFT);
+            host_consumer_send(AUDIO_VOL_UP);
+            return false;
+    }
+    return true;
+}
+
+class ReportCoalescing : public TestFixture {};
+
+TEST_F(ReportCoalescing, ReleasesInOneScan_AreMerged) {
+    TestDriver driver;
+    KeymapKey  key_x = KeymapKey(0, 0, 0, KC_X);
+    KeymapKey  key_y = KeymapKey(0, 1, 0, KC_Y);
+    KeymapKey  key_z = KeymapKey(0, 2, 0, KC_Z);
+    set_keymap({key_x, key_y, key_z});
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_REPORT(driver, (KC_X, KC_Y));
+    EXPECT_REPORT(driver, (KC_X, KC_Y, KC_Z));
+    key_x.press();
+    key_y.press();
+    key_z.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Three releases, one report
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    key_x.release();
+    key_y.release();
+    key_z.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, PressesInOneScan_KeepTheirOrder) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_x = KeymapKey(0, 0, 0, KC_X);
+    KeymapKey  key_y = KeymapKey(0, 1, 0, KC_Y);
+    set_keymap({key_x, key_y});
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_REPORT(driver, (KC_X, KC_Y));
+    key_x.press();
+    key_y.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_x.release();
+    key_y.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, TapInOneScan_IsNotLost) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_tap = KeymapKey(0, 0, 0, TAP_A);
+    set_keymap({key_tap});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_tap.press();
+    run_one_scan_loop();
+    key_tap.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, ModifierAndKey_KeepTheirOrder) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shifted = KeymapKey(0, 0, 0, SHIFTED_B);
+    KeymapKey  key_release = KeymapKey(0, 1, 0, RELEASE_SHIFTED_B);
+    set_keymap({key_shifted, key_release});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_B));
+    key_shifted.press();
+    run_one_scan_loop();
+    key_shifted.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_release.press();
+    run_one_scan_loop();
+    key_release.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, PressAndRelease_AreMerged) {
+    TestDriver driver;
+    KeymapKey  key_x = KeymapKey(0, 0, 0, KC_X);
+    KeymapKey  key_y = KeymapKey(0, 1, 0, KC_Y);
+    set_keymap({key_x, key_y});
+
+    EXPECT_REPORT(driver, (KC_X));
+    key_x.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Rolling from X to Y within one scan
+    EXPECT_REPORT(driver, (KC_Y)).Times(1);
+    key_x.release();
+    key_y.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_y.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, Delay_IsNotHeldBack) {
+    TestDriver            driver;
+    std::vector<uint16_t> times;
+    KeymapKey             key_slow = KeymapKey(0, 0, 0, SLOW_TAP_C);
+    set_keymap({key_slow});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&times](report_keyboard_t&) { times.push_back(timer_read()); }));
+    key_slow.press();
+    run_one_scan_loop();
+    key_slow.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(times.size(), 2);
+    EXPECT_GE(TIMER_DIFF_16(times[1], times[0]), 20) << "The press should have been sent before the delay";
+}
+
+TEST_F(ReportCoalescing, Delay16_IsNotHeldBack) {
+    TestDriver            driver;
+    std::vector<uint16_t> times;
+    KeymapKey             key_slow = KeymapKey(0, 0, 0, SLOW_TAP_SHIFTED_C);
+    set_keymap({key_slow});
+
+    // Only the reports from the press of C onwards, as shift on its own goes out straight away
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&times](report_keyboard_t& report) {
+        if (!times.empty() || KeyboardReport(KC_LSFT, KC_C).Matches(report)) {
+            times.push_back(timer_read());
+        }
+    }));
+    key_slow.press();
+    run_one_scan_loop();
+    key_slow.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_GE(times.size(), 2);
+    EXPECT_GE(TIMER_DIFF_16(times[1], times[0]), 20) << "The press should have been sent before the delay";
+}
+
+TEST_F(ReportCoalescing, OutsideOfScan_SentStraightAway) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_Q));
+    register_code(KC_Q);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    unregister_code(KC_Q);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, MouseReport_DoesNotOvertakeStagedReport) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift_click = KeymapKey(0, 0, 0, SHIFT_CLICK);
+    set_keymap({key_shift_click});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    key_shift_click.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    unregister_code(KC_LSFT);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, ConsumerReport_DoesNotOvertakeStagedReport) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift_volume_up = KeymapKey(0, 0, 0, SHIFT_VOLUME_UP);
+    set_keymap({key_shift_volume_up});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_CALL(driver, send_extra_mock(_));
+    key_shift_volume_up.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_CALL(driver, send_extra_mock(_));
+    unregister_code(KC_LSFT);
+    host_consumer_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
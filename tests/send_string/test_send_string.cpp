@@ -0,0 +1,218 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+using testing::Invoke;
+
+class SendStringNonBlocking : public TestFixture {
+   protected:
+    // Runs scan loops until the queue is empty, returns the number of loops it took
+    unsigned run_until_idle(unsigned limit = 1000) {
+        unsigned loops = 0;
+        while (send_string_pending() && loops < limit) {
+            run_one_scan_loop();
+            loops++;
+        }
+        EXPECT_FALSE(send_string_pending()) << "Queue was not drained within " << limit << " loops";
+        return loops;
+    }
+};
+
+TEST_F(SendStringNonBlocking, TypesInOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("Ab" SS_TAP(X_LCTL));
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNonBlocking, DoesNotBlockScanning) {
+    TestDriver driver;
+    KeymapKey  key_x = KeymapKey(0, 0, 0, KC_X);
+    set_keymap({key_x});
+
+    // Sending only queues the keystrokes
+    EXPECT_NO_REPORT(driver);
+    send_string("abcdefgh");
+    EXPECT_TRUE(send_string_pending());
+    VERIFY_AND_CLEAR(driver);
+
+    // A key pressed while the string is being typed is reported straight away
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_X));
+    EXPECT_REPORT(driver, (KC_X)).Times(testing::AtLeast(1));
+    EXPECT_REPORT(driver, (KC_X, KC_B)).Times(testing::AtMost(1));
+    key_x.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(send_string_pending()) << "Typing should still be in progress";
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    key_x.release();
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNonBlocking, PacedByInterval) {
+    TestDriver            driver;
+    std::vector<uint16_t> times;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&times](report_keyboard_t&) { times.push_back(timer_read()); }));
+    send_string("qmk");
+    unsigned loops = run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(times.size(), 6) << "Expected a press and a release for every character";
+    for (size_t i = 1; i < times.size(); i++) {
+        EXPECT_GE(TIMER_DIFF_16(times[i], times[i - 1]), 1) << "Reports " << i - 1 << " and " << i << " were sent within the same millisecond";
+    }
+    EXPECT_LE(loops, times.size() + 1) << "Typing should not take longer than one report per millisecond";
+}
+
+TEST_F(SendStringNonBlocking, QueueOverflow_TypesEverything) {
+    TestDriver  driver;
+    std::string expected;
+    std::string typed;
+
+    // Longer than the queue, so sending has to wait for part of it to be typed
+    for (int i = 0; i < 3 * SEND_STRING_QUEUE_SIZE; i++) {
+        expected += 'a' + (i % 26);
+    }
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&typed](report_keyboard_t& report) {
+        if (report.keys[0] != KC_NO) {
+            typed += 'a' + (report.keys[0] - KC_A);
+        }
+    }));
+    send_string(expected.c_str());
+    run_until_idle(4 * expected.size());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, expected);
+}
+
+TEST_F(SendStringNonBlocking, HonoursDelay) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("a" SS_DELAY(50) "b");
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    EXPECT_FALSE(send_string_pending());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNonBlocking, Flush_TypesSynchronously) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("x");
+    send_char('y');
+    send_string_flush();
+    EXPECT_FALSE(send_string_pending());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNonBlocking, ReusedBuffer_TypesOriginalString) {
+    TestDriver driver;
+    InSequence s;
+    char       buffer[] = "go";
+
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_O));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string(buffer);
+    memset(buffer, 'z', strlen(buffer));
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNonBlocking, DirectTap_TypedAfterQueuedString) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_O));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_K));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_1));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("ok");
+    tap_code(KC_ENTER);
+    tap_code16(KC_EXLM);
+    EXPECT_FALSE(send_string_pending());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNonBlocking, RandomBase64_Queued) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    send_string("a");
+    tap_random_base64();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AtLeast(2));
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNonBlocking, Unicode_HexTypedWhileAltIsHeld) {
+    TestDriver driver;
+    InSequence s;
+
+    set_unicode_input_mode(UNICODE_MODE_MACOS);
+
+    // Alt+00E9 é
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_0, KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_0, KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_E, KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_9, KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_EMPTY_REPORT(driver);
+    register_unicode(0x00E9);
+    VERIFY_AND_CLEAR(driver);
+}
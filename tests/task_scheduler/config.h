@@ -0,0 +1,13 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+#define COMBO_TERM 30
+#define CAPS_WORD_IDLE_TIMEOUT 1000
+#define LAYER_LOCK_IDLE_TIMEOUT 2000
+#define LEADER_TIMEOUT 300
+#define SECURE_IDLE_TIMEOUT 5000
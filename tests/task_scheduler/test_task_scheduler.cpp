@@ -0,0 +1,156 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class TaskScheduler : public TestFixture {
+   protected:
+    void expect_deadline(uint32_t expected) {
+        uint32_t deadline = 0;
+        ASSERT_TRUE(task_scheduler_next_deadline(&deadline));
+        EXPECT_EQ(deadline, expected);
+    }
+
+    void expect_nothing_scheduled() {
+        uint32_t deadline = 0;
+        EXPECT_FALSE(task_scheduler_next_deadline(&deadline)) << "deadline " << deadline << " at " << timer_read32();
+    }
+};
+
+TEST_F(TaskScheduler, Idle_NothingScheduled) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    expect_nothing_scheduled();
+    EXPECT_EQ(task_scheduler_take_due(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, CapsWord_ScheduledForItsIdleTimeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    caps_word_on();
+    uint32_t on_time = timer_read32();
+    run_one_scan_loop();
+    expect_deadline(on_time + CAPS_WORD_IDLE_TIMEOUT);
+
+    idle_for(CAPS_WORD_IDLE_TIMEOUT - 1);
+    EXPECT_TRUE(is_caps_word_on());
+    run_one_scan_loop();
+    EXPECT_FALSE(is_caps_word_on());
+    expect_nothing_scheduled();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, TapDance_ScheduledAfterTheTappingTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(0));
+
+    set_keymap({key_td});
+
+    EXPECT_NO_REPORT(driver);
+    key_td.press();
+    uint32_t tap_time = timer_read32();
+    run_one_scan_loop();
+    key_td.release();
+    run_one_scan_loop();
+    expect_deadline(tap_time + TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    // Finishes on the first pass after the tapping term, as when it was checked on every pass
+    idle_for(TAPPING_TERM - 1);
+    EXPECT_REPORT(driver, (KC_SEMICOLON));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    expect_nothing_scheduled();
+}
+
+TEST_F(TaskScheduler, Combo_KeyReleasedAfterTheComboTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_j = KeymapKey(0, 1, 0, KC_J);
+    auto       key_k = KeymapKey(0, 2, 0, KC_K);
+
+    set_keymap({key_j, key_k});
+
+    // A combo timer started at time 0 reads as not running
+    idle_for(10);
+
+    EXPECT_NO_REPORT(driver);
+    key_j.press();
+    uint32_t press_time = timer_read32();
+    run_one_scan_loop();
+    expect_deadline(press_time + COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_J));
+    idle_for(COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_j.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, Secure_ActivityMovesTheDeadline) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    secure_unlock();
+    run_one_scan_loop();
+    idle_for(1000);
+    secure_activity_event();
+    uint32_t activity_time = timer_read32();
+    run_one_scan_loop();
+    expect_deadline(activity_time + SECURE_IDLE_TIMEOUT);
+
+    secure_lock();
+    idle_for(SECURE_IDLE_TIMEOUT);
+    expect_nothing_scheduled();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, LayerLock_UnlocksAfterTheIdleTimeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    layer_lock_on(1);
+    uint32_t lock_time = timer_read32();
+    run_one_scan_loop();
+    expect_deadline(lock_time + LAYER_LOCK_IDLE_TIMEOUT + 1);
+
+    idle_for(LAYER_LOCK_IDLE_TIMEOUT);
+    EXPECT_TRUE(is_layer_locked(1));
+    run_one_scan_loop();
+    EXPECT_FALSE(is_layer_locked(1));
+    expect_nothing_scheduled();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, Leader_TimesOut) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    leader_start();
+    uint32_t start_time = timer_read32();
+    run_one_scan_loop();
+    expect_deadline(start_time + LEADER_TIMEOUT + 1);
+
+    idle_for(LEADER_TIMEOUT);
+    EXPECT_TRUE(leader_sequence_active());
+    run_one_scan_loop();
+    EXPECT_FALSE(leader_sequence_active());
+    expect_nothing_scheduled();
+    VERIFY_AND_CLEAR(driver);
+}
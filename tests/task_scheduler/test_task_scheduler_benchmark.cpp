@@ -0,0 +1,79 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" void quantum_task(void);
+
+/*
+    Compares a pass of quantum_task, which only runs the subsystems that are due, against calling every
+    subsystem on every pass as before. Many passes fit into each millisecond, so the simulated time is
+    left alone while measuring.
+*/
+
+namespace {
+
+const int iterations = 200000;
+
+// Every subsystem on every pass, as used before
+void unscheduled_quantum_task(void) {
+    tap_dance_task();
+    combo_task();
+    leader_task();
+    caps_word_task();
+    secure_task();
+    layer_lock_task();
+}
+
+double ns_per_pass(void (*task)(void)) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        task();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+} // namespace
+
+class TaskSchedulerBenchmark : public TestFixture {
+   protected:
+    void compare(const char *name) {
+        double unscheduled = ns_per_pass(unscheduled_quantum_task);
+        double scheduled   = ns_per_pass(quantum_task);
+
+        std::cout << name << ": quantum_task unscheduled=" << unscheduled << "ns scheduled=" << scheduled << "ns" << std::endl;
+        RecordProperty(std::string(name) + "_unscheduled_ns", std::to_string(unscheduled));
+        RecordProperty(std::string(name) + "_scheduled_ns", std::to_string(scheduled));
+    }
+};
+
+TEST_F(TaskSchedulerBenchmark, Idle) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    compare("idle");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskSchedulerBenchmark, WaitingOnTimeouts) {
+    TestDriver driver;
+
+    // Caps Word, Secure and Layer Lock all waiting on their idle timeouts
+    EXPECT_NO_REPORT(driver);
+    caps_word_on();
+    secure_unlock();
+    layer_lock_on(1);
+    idle_for(10);
+    compare("waiting");
+
+    caps_word_off();
+    secure_lock();
+    layer_lock_all_off();
+    VERIFY_AND_CLEAR(driver);
+}
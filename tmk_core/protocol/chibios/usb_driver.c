@@ -74,6 +74,30 @@ static void obnotify(io_buffers_queue_t *bqp) {
     }
 }
 
+#if defined(USB_NONBLOCKING_REPORTS)
+/**
+ * @brief   Copies a report into the next empty buffer of the output queue and
+ *          posts it for transmission, the queue must not be full.
+ */
+static void usb_endpoint_in_post_report_i(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size) {
+    uint8_t *buffer = obqGetEmptyBufferI(&endpoint->obqueue);
+    memcpy(buffer, data, size);
+    obqPostFullBufferI(&endpoint->obqueue, size);
+
+    uint8_t depth = endpoint->obqueue.bn - bqSpaceI(&endpoint->obqueue);
+    if (depth > endpoint->stats.peak_depth) {
+        endpoint->stats.peak_depth = depth;
+    }
+}
+#endif
+
+static void usb_endpoint_in_reset_i(usb_endpoint_in_t *endpoint) {
+    obqResetI(&endpoint->obqueue);
+#if defined(USB_NONBLOCKING_REPORTS)
+    endpoint->pending.size = 0;
+#endif
+}
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -123,7 +147,7 @@ void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint) {
     endpoint->config.usbp->in_params[endpoint->config.ep - 1U] = NULL;
 
     bqSuspendI(&endpoint->obqueue);
-    obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_i(endpoint);
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
     }
@@ -145,7 +169,7 @@ void usb_endpoint_out_stop(usb_endpoint_out_t *endpoint) {
 
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint) {
     bqSuspendI(&endpoint->obqueue);
-    obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_i(endpoint);
 
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
@@ -167,7 +191,7 @@ void usb_endpoint_out_wakeup_cb(usb_endpoint_out_t *endpoint) {
 
 void usb_endpoint_in_configure_cb(usb_endpoint_in_t *endpoint) {
     usbInitEndpointI(endpoint->config.usbp, endpoint->config.ep, &endpoint->ep_config);
-    obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_i(endpoint);
     bqResumeX(&endpoint->obqueue);
 }
 
@@ -225,6 +249,16 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
         /* Nothing to transmit.*/
     }
 
+#if defined(USB_NONBLOCKING_REPORTS)
+    /* A report that found the queue full takes the buffer just freed. This is
+     * done after starting the next transaction, so that posting it does not
+     * start a second one from the queue notification. */
+    if (endpoint->pending.size > 0 && !obqIsFullI(&endpoint->obqueue)) {
+        usb_endpoint_in_post_report_i(endpoint, endpoint->pending.buffer, endpoint->pending.size);
+        endpoint->pending.size = 0;
+    }
+#endif
+
     osalSysUnlockFromISR();
 }
 
@@ -276,7 +310,7 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
             osalSysLock();
             endpoint->timed_out |= sent == 0;
             bqSuspendI(&endpoint->obqueue);
-            obqResetI(&endpoint->obqueue);
+            usb_endpoint_in_reset_i(endpoint);
             bqResumeX(&endpoint->obqueue);
             osalOsRescheduleS();
             osalSysUnlock();
@@ -291,6 +325,67 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     }
 }
 
+#if defined(USB_NONBLOCKING_REPORTS)
+/**
+ * @brief Queue a report for sending without waiting for the endpoint. If all
+ * buffers are in use a mergeable report is kept aside and posted from the
+ * transmit complete callback as soon as a buffer is freed, replacing an older
+ * one of the same kind that was still waiting. Any other report waits for the
+ * queue like `usb_endpoint_in_send`, so that no report is lost.
+ *
+ * @param endpoint USB IN endpoint to send the report from
+ * @param data pointer to the report
+ * @param size size of the report
+ * @param has_report_id the first byte of the report is its report ID
+ * @param mergeable the report carries the complete state of its inputs, and
+ * may be replaced by a newer one of the same kind
+ * @return true Success
+ * @return false Failure
+ */
+bool usb_endpoint_in_queue(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, bool has_report_id, bool mergeable) {
+    osalDbgCheck((endpoint != NULL) && (data != NULL) && (size > 0U) && (size <= endpoint->config.buffer_size));
+
+    osalSysLock();
+    if (usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE || bqIsSuspendedX(&endpoint->obqueue)) {
+        osalSysUnlock();
+        return false;
+    }
+
+    switch (usb_report_queue_action(&endpoint->pending, obqIsFullI(&endpoint->obqueue), data, size, has_report_id, mergeable)) {
+        case USB_REPORT_QUEUE_POST:
+            usb_endpoint_in_post_report_i(endpoint, data, size);
+            osalOsRescheduleS();
+            osalSysUnlock();
+            return true;
+        case USB_REPORT_QUEUE_REPLACE:
+            endpoint->stats.merged++;
+            /* fall through */
+        case USB_REPORT_QUEUE_KEEP:
+            memcpy(endpoint->pending.buffer, data, size);
+            endpoint->pending.size = size;
+            osalSysUnlock();
+            return true;
+        case USB_REPORT_QUEUE_WAIT:
+        default:
+            break;
+    }
+    osalSysUnlock();
+
+    /* The report kept aside is posted before any buffer becomes available to
+     * the waiting write, so the order of the reports is kept. */
+    return usb_endpoint_in_send(endpoint, data, size, TIME_MS2I(100), false);
+}
+
+void usb_endpoint_in_get_stats(usb_endpoint_in_t *endpoint, usb_endpoint_in_stats_t *stats) {
+    osalDbgCheck((endpoint != NULL) && (stats != NULL));
+
+    osalSysLock();
+    *stats       = endpoint->stats;
+    stats->depth = endpoint->obqueue.bn - bqSpaceI(&endpoint->obqueue) + (endpoint->pending.size > 0 ? 1 : 0);
+    osalSysUnlock();
+}
+#endif
+
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded) {
     osalDbgCheck(endpoint != NULL);
 
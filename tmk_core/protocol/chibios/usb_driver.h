@@ -10,6 +10,7 @@
 #include "usb_descriptor.h"
 #include "chibios_config.h"
 #include "usb_report_handling.h"
+#include "usb_report_queue.h"
 #include "string.h"
 #include "timer.h"
 
@@ -24,6 +25,12 @@
             NULL, /* SETUP buffer (not a SETUP endpoint) */
 #endif
 
+#if defined(USB_NONBLOCKING_REPORTS)
+#    define QMK_USB_ENDPOINT_IN_PENDING(ep_size) .pending = {.buffer = (_Alignas(4) uint8_t[ep_size]){0}},
+#else
+#    define QMK_USB_ENDPOINT_IN_PENDING(ep_size)
+#endif
+
 /*
  * Implementation notes:
  *
@@ -36,6 +43,7 @@
 #define QMK_USB_ENDPOINT_IN(mode, ep_size, ep_num, _buffer_capacity, _usb_requests_cb, _report_storage) \
     {                                                                                                   \
         .usb_requests_cb = _usb_requests_cb, .report_storage = _report_storage,                         \
+        QMK_USB_ENDPOINT_IN_PENDING(ep_size)                                                            \
         .ep_config =                                                                                    \
             {                                                                                           \
                 mode,                           /* EP Mode */                                           \
@@ -87,6 +95,7 @@
 #    define QMK_USB_ENDPOINT_IN_SHARED(mode, ep_size, ep_num, _buffer_capacity, _usb_requests_cb, _report_storage) \
         {                                                                                                          \
             .usb_requests_cb = _usb_requests_cb, .is_shared = true, .report_storage = _report_storage,             \
+            QMK_USB_ENDPOINT_IN_PENDING(ep_size)                                                                   \
             .ep_config =                                                                                           \
                 {                                                                                                  \
                     mode,                            /* EP Mode */                                                 \
@@ -154,6 +163,23 @@ typedef struct {
     uint8_t *buffer;
 } usb_endpoint_config_t;
 
+typedef struct {
+    /**
+     * @brief Reports waiting in the queue right now
+     */
+    uint8_t depth;
+
+    /**
+     * @brief The most reports that have been waiting in the queue at once
+     */
+    uint8_t peak_depth;
+
+    /**
+     * @brief Reports that were replaced by a newer one of the same kind before they could be sent
+     */
+    uint16_t merged;
+} usb_endpoint_in_stats_t;
+
 typedef struct {
     output_buffers_queue_t obqueue;
     USBEndpointConfig      ep_config;
@@ -166,6 +192,10 @@ typedef struct {
     usbreqhandler_t       usb_requests_cb;
     bool                  timed_out;
     usb_report_storage_t *report_storage;
+#if defined(USB_NONBLOCKING_REPORTS)
+    usb_report_pending_t    pending;
+    usb_endpoint_in_stats_t stats;
+#endif
 } usb_endpoint_in_t;
 
 typedef struct {
@@ -186,6 +216,10 @@ void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint);
 
 bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, sysinterval_t timeout, bool buffered);
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded);
+#if defined(USB_NONBLOCKING_REPORTS)
+bool usb_endpoint_in_queue(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, bool has_report_id, bool mergeable);
+void usb_endpoint_in_get_stats(usb_endpoint_in_t *endpoint, usb_endpoint_in_stats_t *stats);
+#endif
 bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint);
 
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint);
@@ -54,6 +54,7 @@ extern keymap_config_t keymap_config;
 extern usb_endpoint_in_t  usb_endpoints_in[USB_ENDPOINT_IN_COUNT];
 extern usb_endpoint_out_t usb_endpoints_out[USB_ENDPOINT_OUT_COUNT];
 
+static bool __attribute__((__unused__)) send_state_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size, bool mergeable);
 static bool __attribute__((__unused__)) send_report_buffered(usb_endpoint_in_lut_t endpoint, void *report, size_t size);
 static void __attribute__((__unused__)) flush_report_buffered(usb_endpoint_in_lut_t endpoint, bool padded);
 static bool __attribute__((__unused__)) receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t size);
@@ -393,6 +394,48 @@ bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
     return usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)report, size, TIME_MS2I(100), false);
 }
 
+/**
+ * @brief Send a report that carries the complete state of its inputs, such as
+ * the keyboard or consumer reports. With `USB_NONBLOCKING_REPORTS` the report
+ * is queued without waiting for the endpoint. If the queue is full a mergeable
+ * report replaces a waiting report of the same kind, anything else waits for
+ * the queue. Otherwise it is the same as `send_report`.
+ *
+ * @param endpoint USB IN endpoint to send the report from
+ * @param report pointer to the report
+ * @param size size of the report
+ * @param mergeable a newer report of the same kind carries everything this
+ * one does, which is not the case for reports that record presses and
+ * releases, such as a tap of a key, a consumer usage or a button
+ * @return true Success
+ * @return false Failure
+ */
+static bool send_state_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size, bool mergeable) {
+#if defined(USB_NONBLOCKING_REPORTS)
+#    if defined(SHARED_EP_ENABLE)
+    bool has_report_id = endpoint == USB_ENDPOINT_IN_SHARED;
+#    else
+    bool has_report_id = false;
+#    endif
+    return usb_endpoint_in_queue(&usb_endpoints_in[endpoint], (uint8_t *)report, size, has_report_id, mergeable);
+#else
+    (void)mergeable;
+    return send_report(endpoint, report, size);
+#endif
+}
+
+#if defined(USB_NONBLOCKING_REPORTS)
+/**
+ * @brief Get the queue depth and merge counters of a USB IN endpoint.
+ *
+ * @param endpoint USB IN endpoint to get the counters of
+ * @param stats the counters are copied here
+ */
+void get_usb_report_stats(usb_endpoint_in_lut_t endpoint, usb_endpoint_in_stats_t *stats) {
+    usb_endpoint_in_get_stats(&usb_endpoints_in[endpoint], stats);
+}
+#endif
+
 /**
  * @brief Send a report to the host, but delay the sending until the size of
  * endpoint report is reached or the incompletely filled buffer is flushed with
@@ -437,15 +480,15 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
 void send_keyboard(report_keyboard_t *report) {
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
+        send_state_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8, false);
     } else {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+        send_state_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE, false);
     }
 }
 
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
+    send_state_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t), false);
 #endif
 }
 
@@ -467,25 +510,25 @@ void send_mouse(report_mouse_t *report) {
 
 void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t));
+    send_state_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t), false);
 #endif
 }
 
 void send_programmable_button(report_programmable_button_t *report) {
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_programmable_button_t));
+    send_state_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_programmable_button_t), false);
 #endif
 }
 
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
-    send_report(USB_ENDPOINT_IN_JOYSTICK, report, sizeof(report_joystick_t));
+    send_state_report(USB_ENDPOINT_IN_JOYSTICK, report, sizeof(report_joystick_t), false);
 #endif
 }
 
 void send_digitizer(report_digitizer_t *report) {
 #ifdef DIGITIZER_ENABLE
-    send_report(USB_ENDPOINT_IN_DIGITIZER, report, sizeof(report_digitizer_t));
+    send_state_report(USB_ENDPOINT_IN_DIGITIZER, report, sizeof(report_digitizer_t), false);
 #endif
 }
 
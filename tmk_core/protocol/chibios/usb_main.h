@@ -34,6 +34,11 @@ void restart_usb_driver(USBDriver *usbp);
 
 bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size);
 
+#if defined(USB_NONBLOCKING_REPORTS)
+/* Get the queue depth and merge counters of an endpoint */
+void get_usb_report_stats(usb_endpoint_in_lut_t endpoint, usb_endpoint_in_stats_t *stats);
+#endif
+
 /* ---------------
  * USB Event queue
  * ---------------
@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode.h"
 #include "host.h"
@@ -134,13 +135,10 @@ led_t host_keyboard_led_state(void) {
 }
 
 /* send report */
-void host_keyboard_send(report_keyboard_t *report) {
+static void keyboard_send(report_keyboard_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_keyboard) return;
 
-#ifdef KEYBOARD_SHARED_EP
-    report->report_id = REPORT_ID_KEYBOARD;
-#endif
     (*driver->send_keyboard)(report);
 
     if (debug_keyboard) {
@@ -152,11 +150,10 @@ void host_keyboard_send(report_keyboard_t *report) {
     }
 }
 
-void host_nkro_send(report_nkro_t *report) {
+static void nkro_send(report_nkro_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_nkro) return;
 
-    report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
 
     if (debug_keyboard) {
@@ -168,7 +165,179 @@ void host_nkro_send(report_nkro_t *report) {
     }
 }
 
+#ifdef KEYBOARD_REPORT_COALESCING
+/*
+ * While keyboard_task() runs, the keyboard report is staged instead of being sent straight away, so that the changes
+ * made within one scan reach the host in as few reports as possible. The staged report is sent at the end of the scan,
+ * or before the next report if merging the two would lose something the host has to see:
+ *   - a key or modifier changing twice, such as a tap, would not be seen at all
+ *   - modifiers and keys changed in two steps, such as Shift and then A, have to arrive in that order
+ *   - keys pressed in two steps have to arrive in that order, as NKRO reports do not have one
+ * Anything waiting in between reports calls host_keyboard_flush() first, so that the staged report is not held back,
+ * and so do the mouse, system and consumer reports, so that they do not overtake it.
+ */
+enum { STAGED_NONE, STAGED_KEYBOARD, STAGED_NKRO };
+
+typedef struct {
+    uint8_t mods;     // changed modifiers
+    bool    pressed;  // whether any keys were pressed
+    bool    released; // whether any keys were released
+} report_changes_t;
+
+static struct {
+    bool              active;
+    uint8_t           type;
+    report_keyboard_t keyboard;
+    report_keyboard_t keyboard_sent;
+#    ifdef NKRO_ENABLE
+    report_nkro_t nkro;
+    report_nkro_t nkro_sent;
+#    endif
+} staging;
+
+static bool keyboard_report_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) return true;
+    }
+    return false;
+}
+
+static report_changes_t keyboard_report_changes(const report_keyboard_t *from, const report_keyboard_t *to) {
+    report_changes_t changes = {.mods = from->mods ^ to->mods};
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        changes.pressed |= to->keys[i] != KC_NO && !keyboard_report_has_key(from, to->keys[i]);
+        changes.released |= from->keys[i] != KC_NO && !keyboard_report_has_key(to, from->keys[i]);
+    }
+    return changes;
+}
+
+// Whether any key changes both from `sent` to `staged` and from `staged` to `next`
+static bool keyboard_report_changes_twice(const report_keyboard_t *sent, const report_keyboard_t *staged, const report_keyboard_t *next) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = staged->keys[i];
+        if (key != KC_NO && !keyboard_report_has_key(sent, key) && !keyboard_report_has_key(next, key)) return true;
+        key = sent->keys[i];
+        if (key != KC_NO && !keyboard_report_has_key(staged, key) && keyboard_report_has_key(next, key)) return true;
+    }
+    return false;
+}
+
+#    ifdef NKRO_ENABLE
+static report_changes_t nkro_report_changes(const report_nkro_t *from, const report_nkro_t *to) {
+    report_changes_t changes = {.mods = from->mods ^ to->mods};
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        changes.pressed |= (to->bits[i] & ~from->bits[i]) != 0;
+        changes.released |= (from->bits[i] & ~to->bits[i]) != 0;
+    }
+    return changes;
+}
+
+static bool nkro_report_changes_twice(const report_nkro_t *sent, const report_nkro_t *staged, const report_nkro_t *next) {
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if ((sent->bits[i] ^ staged->bits[i]) & (staged->bits[i] ^ next->bits[i])) return true;
+    }
+    return false;
+}
+#    endif
+
+static bool can_merge(report_changes_t staged, report_changes_t next) {
+    bool staged_keys = staged.pressed || staged.released;
+    bool next_keys   = next.pressed || next.released;
+
+    // a modifier changing twice
+    if (staged.mods & next.mods) return false;
+    if ((staged.mods && next_keys) || (staged_keys && next.mods)) return false;
+    return !(staged.pressed && next.pressed);
+}
+
+void host_keyboard_flush(void) {
+    switch (staging.type) {
+        case STAGED_KEYBOARD:
+            staging.keyboard_sent = staging.keyboard;
+            keyboard_send(&staging.keyboard);
+            break;
+#    ifdef NKRO_ENABLE
+        case STAGED_NKRO:
+            staging.nkro_sent = staging.nkro;
+            nkro_send(&staging.nkro);
+            break;
+#    endif
+    }
+    staging.type = STAGED_NONE;
+}
+
+void host_keyboard_coalesce_begin(void) {
+    staging.active = true;
+}
+
+void host_keyboard_coalesce_end(void) {
+    staging.active = false;
+    host_keyboard_flush();
+}
+
+static void stage_keyboard_report(report_keyboard_t *report) {
+    if (staging.type == STAGED_KEYBOARD) {
+        if (memcmp(report, &staging.keyboard, sizeof(report_keyboard_t)) == 0) return;
+        if (keyboard_report_changes_twice(&staging.keyboard_sent, &staging.keyboard, report) || !can_merge(keyboard_report_changes(&staging.keyboard_sent, &staging.keyboard), keyboard_report_changes(&staging.keyboard, report))) {
+            host_keyboard_flush();
+        }
+    } else {
+        host_keyboard_flush();
+        if (memcmp(report, &staging.keyboard_sent, sizeof(report_keyboard_t)) == 0) return;
+    }
+
+    staging.keyboard = *report;
+    staging.type     = STAGED_KEYBOARD;
+    if (!staging.active) {
+        host_keyboard_flush();
+    }
+}
+
+#    ifdef NKRO_ENABLE
+static void stage_nkro_report(report_nkro_t *report) {
+    if (staging.type == STAGED_NKRO) {
+        if (memcmp(report, &staging.nkro, sizeof(report_nkro_t)) == 0) return;
+        if (nkro_report_changes_twice(&staging.nkro_sent, &staging.nkro, report) || !can_merge(nkro_report_changes(&staging.nkro_sent, &staging.nkro), nkro_report_changes(&staging.nkro, report))) {
+            host_keyboard_flush();
+        }
+    } else {
+        host_keyboard_flush();
+        if (memcmp(report, &staging.nkro_sent, sizeof(report_nkro_t)) == 0) return;
+    }
+
+    staging.nkro = *report;
+    staging.type = STAGED_NKRO;
+    if (!staging.active) {
+        host_keyboard_flush();
+    }
+}
+#    endif
+#endif
+
+void host_keyboard_send(report_keyboard_t *report) {
+#ifdef KEYBOARD_SHARED_EP
+    report->report_id = REPORT_ID_KEYBOARD;
+#endif
+#ifdef KEYBOARD_REPORT_COALESCING
+    stage_keyboard_report(report);
+#else
+    keyboard_send(report);
+#endif
+}
+
+void host_nkro_send(report_nkro_t *report) {
+    report->report_id = REPORT_ID_NKRO;
+#if defined(KEYBOARD_REPORT_COALESCING) && defined(NKRO_ENABLE)
+    stage_nkro_report(report);
+#else
+    nkro_send(report);
+#endif
+}
+
 void host_mouse_send(report_mouse_t *report) {
+    // The staged keyboard report goes first, Shift+click has to arrive shifted
+    host_keyboard_flush();
+
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_mouse) return;
 
@@ -184,6 +353,8 @@ void host_mouse_send(report_mouse_t *report) {
 }
 
 void host_system_send(uint16_t usage) {
+    host_keyboard_flush();
+
     if (usage == last_system_usage) return;
     last_system_usage = usage;
 
@@ -198,6 +369,8 @@ void host_system_send(uint16_t usage) {
 }
 
 void host_consumer_send(uint16_t usage) {
+    host_keyboard_flush();
+
     if (usage == last_consumer_usage) return;
     last_consumer_usage = usage;
 
@@ -46,6 +46,17 @@ void    host_raw_hid_send(uint8_t *data, uint8_t length);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+/* keyboard report coalescing */
+#ifdef KEYBOARD_REPORT_COALESCING
+void host_keyboard_coalesce_begin(void);
+void host_keyboard_coalesce_end(void);
+void host_keyboard_flush(void);
+#else
+#    define host_keyboard_coalesce_begin()
+#    define host_keyboard_coalesce_end()
+#    define host_keyboard_flush()
+#endif
+
 #ifdef __cplusplus
 }
 #endif
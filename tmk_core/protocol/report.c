@@ -23,37 +23,87 @@
 #include "util.h"
 #include <string.h>
 
-/** \brief has_anykey
+#ifdef NKRO_ENABLE
+/*
+ * The NKRO bitmap is processed a machine word at a time. It is not aligned within the report, so the words are copied
+ * out with memcpy(), which compiles to a single load on cores that support unaligned access. Bytes are used where
+ * wider words do not help, or where the bit order within a word would not match the keycodes.
+ */
+#    if defined(__AVR__) || __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+typedef uint8_t nkro_word_t;
+#    else
+typedef uint32_t nkro_word_t;
+#    endif
+
+// Keys pressed in nkro_report, kept up to date by add_key_bit() and del_key_bit()
+static uint8_t nkro_key_count = 0;
+
+static inline nkro_word_t nkro_read_word(const uint8_t* bits) {
+    nkro_word_t word;
+    memcpy(&word, bits, sizeof(word));
+    return word;
+}
+
+/** \brief Counts the keys pressed in an NKRO report
+ */
+uint8_t nkro_report_count_keys(const report_nkro_t* report) {
+    uint8_t count = 0;
+    uint8_t i     = 0;
+    for (; i + sizeof(nkro_word_t) <= NKRO_REPORT_BITS; i += sizeof(nkro_word_t)) {
+        count += __builtin_popcount(nkro_read_word(&report->bits[i]));
+    }
+    for (; i < NKRO_REPORT_BITS; i++) {
+        count += __builtin_popcount(report->bits[i]);
+    }
+    return count;
+}
+
+/** \brief Finds the lowest keycode pressed in an NKRO report
  *
- * FIXME: Needs doc
+ * Returns KC_NO if no keys are pressed
+ */
+uint8_t nkro_report_first_key(const report_nkro_t* report) {
+    uint8_t i = 0;
+    for (; i + sizeof(nkro_word_t) <= NKRO_REPORT_BITS; i += sizeof(nkro_word_t)) {
+        nkro_word_t word = nkro_read_word(&report->bits[i]);
+        if (word) {
+            return (i << 3) + __builtin_ctz(word);
+        }
+    }
+    for (; i < NKRO_REPORT_BITS; i++) {
+        if (report->bits[i]) {
+            return (i << 3) + __builtin_ctz(report->bits[i]);
+        }
+    }
+    return KC_NO;
+}
+#endif
+
+/** \brief Counts the keys pressed in the keyboard report
+ *
+ * Modifiers are not counted.
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        return nkro_key_count;
     }
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
+    uint8_t cnt = 0;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i]) cnt++;
     }
     return cnt;
 }
 
-/** \brief get_first_key
+/** \brief Returns a key pressed in the keyboard report
  *
- * FIXME: Needs doc
+ * In NKRO mode this is the lowest keycode pressed. Returns KC_NO if no keys are pressed.
  */
 uint8_t get_first_key(void) {
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
-        return i << 3 | biton(nkro_report->bits[i]);
+        return nkro_key_count ? nkro_report_first_key(nkro_report) : KC_NO;
     }
 #endif
     return keyboard_report->keys[0];
@@ -77,12 +127,7 @@ bool is_key_pressed(uint8_t key) {
         }
     }
 #endif
-    for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-        if (keyboard_report->keys[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    return memchr(keyboard_report->keys, key, KEYBOARD_REPORT_KEYS) != NULL;
 }
 
 /** \brief add key byte
@@ -124,9 +169,13 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
  *
  * FIXME: Needs doc
  */
-void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+void add_key_bit(report_nkro_t* report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] |= 1 << (code & 7);
+        uint8_t mask = 1 << (code & 7);
+        if (report == nkro_report && !(report->bits[code >> 3] & mask)) {
+            nkro_key_count++;
+        }
+        report->bits[code >> 3] |= mask;
     } else {
         dprintf("add_key_bit: can't add: %02X\n", code);
     }
@@ -136,9 +185,13 @@ void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
  *
  * FIXME: Needs doc
  */
-void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+void del_key_bit(report_nkro_t* report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] &= ~(1 << (code & 7));
+        uint8_t mask = 1 << (code & 7);
+        if (report == nkro_report && (report->bits[code >> 3] & mask)) {
+            nkro_key_count--;
+        }
+        report->bits[code >> 3] &= ~mask;
     } else {
         dprintf("del_key_bit: can't del: %02X\n", code);
     }
@@ -182,6 +235,7 @@ void clear_keys_from_report(void) {
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
         memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+        nkro_key_count = 0;
         return;
     }
 #endif
@@ -349,6 +349,9 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 #ifdef NKRO_ENABLE
 void add_key_bit(report_nkro_t* nkro_report, uint8_t code);
 void del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+
+uint8_t nkro_report_count_keys(const report_nkro_t* report);
+uint8_t nkro_report_first_key(const report_nkro_t* report);
 #endif
 
 void add_key_to_report(uint8_t key);
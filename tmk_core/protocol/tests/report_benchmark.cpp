@@ -0,0 +1,105 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "report_mocks.hpp"
+
+/*
+    Times nkro_report_count_keys() and nkro_report_first_key() against the byte-at-a-time loops they replaced, on
+    an empty bitmap, one with only the last key set and a full one, and has_anykey() against counting the bitmap.
+*/
+
+namespace {
+
+const int iterations = 200000;
+
+// Byte-at-a-time versions, as used before
+uint8_t bytewise_count_keys(const report_nkro_t *report) {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        for (uint8_t bits = report->bits[i]; bits; bits >>= 1) {
+            count += bits & 1;
+        }
+    }
+    return count;
+}
+
+uint8_t bytewise_first_key(const report_nkro_t *report) {
+    uint8_t i = 0;
+    for (; i < NKRO_REPORT_BITS && !report->bits[i]; i++)
+        ;
+    if (i == NKRO_REPORT_BITS) return KC_NO;
+    uint8_t bit = 0;
+    for (; !(report->bits[i] & (1 << bit)); bit++)
+        ;
+    return i << 3 | bit;
+}
+
+double ns_per_call(const std::function<uint8_t()> &op) {
+    volatile uint8_t sink  = 0;
+    auto             start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        sink = sink + op();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+} // namespace
+
+class ReportBenchmark : public ::testing::Test {
+   protected:
+    void compare(const char *name, const report_nkro_t &report) {
+        // Keep the compiler from hoisting the calls out of the loops
+        const report_nkro_t *volatile target = &report;
+
+        EXPECT_EQ(nkro_report_count_keys(target), bytewise_count_keys(target)) << name;
+        EXPECT_EQ(nkro_report_first_key(target), bytewise_first_key(target)) << name;
+
+        double count_bytes = ns_per_call([&] { return bytewise_count_keys(target); });
+        double count_words = ns_per_call([&] { return nkro_report_count_keys(target); });
+        double first_bytes = ns_per_call([&] { return bytewise_first_key(target); });
+        double first_words = ns_per_call([&] { return nkro_report_first_key(target); });
+
+        std::cout << name << ": count_keys bytewise=" << count_bytes << "ns words=" << count_words << "ns, first_key bytewise=" << first_bytes << "ns words=" << first_words << "ns" << std::endl;
+        RecordProperty(std::string(name) + "_count_keys_bytewise_ns", std::to_string(count_bytes));
+        RecordProperty(std::string(name) + "_count_keys_words_ns", std::to_string(count_words));
+        RecordProperty(std::string(name) + "_first_key_bytewise_ns", std::to_string(first_bytes));
+        RecordProperty(std::string(name) + "_first_key_words_ns", std::to_string(first_words));
+    }
+};
+
+TEST_F(ReportBenchmark, Empty) {
+    report_nkro_t report = {};
+    compare("empty", report);
+}
+
+TEST_F(ReportBenchmark, LastKeyOnly) {
+    report_nkro_t report                 = {};
+    report.bits[NKRO_REPORT_BITS - 1] = 0x80;
+    compare("last_key_only", report);
+}
+
+TEST_F(ReportBenchmark, Full) {
+    report_nkro_t report = {};
+    memset(report.bits, 0xFF, sizeof(report.bits));
+    compare("full", report);
+}
+
+TEST_F(ReportBenchmark, HasAnykey) {
+    mock_reports_reset();
+    for (uint8_t key = KC_A; key <= KC_Z; key++) {
+        add_key_to_report(key);
+    }
+
+    // The running count against counting the bitmap on every call
+    double running = ns_per_call([] { return has_anykey(); });
+    double counted = ns_per_call([] { return bytewise_count_keys(nkro_report); });
+    std::cout << "has_anykey: running=" << running << "ns counted=" << counted << "ns" << std::endl;
+    RecordProperty("has_anykey_running_ns", std::to_string(running));
+    RecordProperty("has_anykey_counted_ns", std::to_string(counted));
+    EXPECT_EQ(has_anykey(), 26);
+}
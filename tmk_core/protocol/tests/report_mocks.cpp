@@ -0,0 +1,32 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "report_mocks.hpp"
+
+extern "C" {
+#include "keycode_config.h"
+}
+
+static report_keyboard_t mock_keyboard_report;
+static report_nkro_t     mock_nkro_report;
+
+bool mock_nkro_enabled = true;
+
+extern "C" {
+report_keyboard_t *keyboard_report = &mock_keyboard_report;
+report_nkro_t     *nkro_report     = &mock_nkro_report;
+keymap_config_t    keymap_config;
+
+bool host_can_send_nkro(void) {
+    return mock_nkro_enabled;
+}
+}
+
+void mock_reports_reset(void) {
+    mock_nkro_enabled  = true;
+    keymap_config.nkro = true;
+    clear_keys_from_report();
+    mock_nkro_enabled = false;
+    clear_keys_from_report();
+    mock_nkro_enabled = true;
+}
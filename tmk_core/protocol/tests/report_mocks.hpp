@@ -0,0 +1,15 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+extern "C" {
+#include "report.h"
+#include "action_util.h"
+#include "keycode.h"
+}
+
+// Whether host_can_send_nkro() allows NKRO
+extern bool mock_nkro_enabled;
+
+// Clears the keyboard reports and enables NKRO
+void mock_reports_reset(void);
@@ -0,0 +1,106 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include "gtest/gtest.h"
+#include "report_mocks.hpp"
+
+class Report : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reports_reset();
+    }
+};
+
+TEST_F(Report, AddKeyBit_CountsEachKeyOnce) {
+    add_key_to_report(KC_A);
+    add_key_to_report(KC_B);
+    add_key_to_report(KC_A);
+    EXPECT_EQ(has_anykey(), 2);
+    EXPECT_EQ(nkro_report_count_keys(nkro_report), 2);
+
+    del_key_from_report(KC_A);
+    del_key_from_report(KC_A);
+    EXPECT_EQ(has_anykey(), 1);
+    EXPECT_TRUE(is_key_pressed(KC_B));
+    EXPECT_FALSE(is_key_pressed(KC_A));
+
+    del_key_from_report(KC_C);
+    EXPECT_EQ(has_anykey(), 1);
+}
+
+TEST_F(Report, AddKeyBit_KeysInTheSameByte) {
+    // Would only count as one with a byte-wise count
+    add_key_to_report(KC_A);
+    add_key_to_report(KC_B);
+    add_key_to_report(KC_C);
+    EXPECT_EQ(has_anykey(), 3);
+}
+
+TEST_F(Report, AddKeyBit_OutOfRange) {
+    add_key_to_report(NKRO_REPORT_BITS * 8);
+    add_key_to_report(0xFF);
+    EXPECT_EQ(has_anykey(), 0);
+    EXPECT_EQ(nkro_report_count_keys(nkro_report), 0);
+}
+
+TEST_F(Report, AddKeyBit_OtherReportsAreNotCounted) {
+    report_nkro_t other = {};
+    add_key_bit(&other, KC_A);
+    EXPECT_EQ(nkro_report_count_keys(&other), 1);
+    EXPECT_EQ(has_anykey(), 0);
+}
+
+TEST_F(Report, ClearKeys_ResetsCount) {
+    for (uint8_t key = KC_A; key <= KC_Z; key++) {
+        add_key_to_report(key);
+    }
+    EXPECT_EQ(has_anykey(), 26);
+
+    clear_keys_from_report();
+    EXPECT_EQ(has_anykey(), 0);
+    EXPECT_EQ(get_first_key(), KC_NO);
+
+    add_key_to_report(KC_Z);
+    EXPECT_EQ(has_anykey(), 1);
+}
+
+TEST_F(Report, FirstKey_EveryKeycode) {
+    EXPECT_EQ(get_first_key(), KC_NO);
+
+    // Covers every position within the words, and the bytes after the last full word
+    for (unsigned key = 1; key < NKRO_REPORT_BITS * 8; key++) {
+        add_key_to_report(key);
+        add_key_to_report(NKRO_REPORT_BITS * 8 - 1);
+        EXPECT_EQ(get_first_key(), key) << "with " << key << " pressed";
+        clear_keys_from_report();
+    }
+}
+
+TEST_F(Report, CountKeys_MatchesBitwiseCount) {
+    std::mt19937 rng(1234);
+    for (int round = 0; round < 200; round++) {
+        report_nkro_t report   = {};
+        unsigned      expected = 0;
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            report.bits[i] = rng() & rng(); // sparse
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                expected += (report.bits[i] >> bit) & 1;
+            }
+        }
+        EXPECT_EQ(nkro_report_count_keys(&report), expected);
+    }
+}
+
+TEST_F(Report, IsKeyPressed_6KRO) {
+    mock_nkro_enabled = false;
+
+    add_key_to_report(KC_A);
+    add_key_to_report(KC_F12);
+    EXPECT_TRUE(is_key_pressed(KC_A));
+    EXPECT_TRUE(is_key_pressed(KC_F12));
+    EXPECT_FALSE(is_key_pressed(KC_B));
+    EXPECT_FALSE(is_key_pressed(KC_NO));
+    EXPECT_EQ(has_anykey(), 2);
+    EXPECT_EQ(get_first_key(), KC_A);
+}
@@ -0,0 +1,11 @@
+report_DEFS := -DNKRO_ENABLE
+
+report_SRC := \
+    $(TMK_PATH)/protocol/tests/report_mocks.cpp \
+    $(TMK_PATH)/protocol/tests/report_tests.cpp \
+    $(TMK_PATH)/protocol/tests/report_benchmark.cpp \
+    $(TMK_PATH)/protocol/report.c
+
+usb_report_queue_SRC := \
+    $(TMK_PATH)/protocol/tests/usb_report_queue_tests.cpp \
+    $(TMK_PATH)/protocol/usb_report_queue.c
@@ -0,0 +1 @@
+TEST_LIST += report usb_report_queue
@@ -0,0 +1,166 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "usb_report_queue.h"
+}
+
+typedef std::vector<uint8_t> Report;
+
+// An IN endpoint as the ChibiOS driver runs it: a bounded queue of buffers that the host takes one
+// at a time, and the report kept aside, which is posted as soon as the host frees a buffer.
+class Endpoint {
+   public:
+    static const size_t CAPACITY = 4;
+
+    Endpoint(bool has_report_id) : has_report_id(has_report_id) {
+        pending.buffer = pending_buffer;
+        pending.size   = 0;
+    }
+
+    // usb_endpoint_in_queue()
+    void send(const Report &report, bool mergeable) {
+        switch (usb_report_queue_action(&pending, queue.size() == CAPACITY, report.data(), report.size(), has_report_id, mergeable)) {
+            case USB_REPORT_QUEUE_POST:
+                queue.push_back(report);
+                break;
+            case USB_REPORT_QUEUE_REPLACE:
+                merged++;
+                // fall through
+            case USB_REPORT_QUEUE_KEEP:
+                memcpy(pending.buffer, report.data(), report.size());
+                pending.size = report.size();
+                break;
+            case USB_REPORT_QUEUE_WAIT:
+                // usb_endpoint_in_send() blocks until the host frees a buffer the kept report does not take
+                while (queue.size() == CAPACITY) {
+                    host_takes_one();
+                }
+                queue.push_back(report);
+                waited++;
+                break;
+        }
+    }
+
+    // usb_endpoint_in_tx_complete_cb()
+    void host_takes_one() {
+        if (queue.empty()) {
+            return;
+        }
+        received.push_back(queue.front());
+        queue.pop_front();
+        if (pending.size > 0) {
+            queue.push_back(Report(pending.buffer, pending.buffer + pending.size));
+            pending.size = 0;
+        }
+    }
+
+    void host_takes_all() {
+        while (!queue.empty()) {
+            host_takes_one();
+        }
+    }
+
+    std::vector<Report> received;
+    int                 merged = 0;
+    int                 waited = 0;
+
+   private:
+    bool                 has_report_id;
+    std::deque<Report>   queue;
+    uint8_t              pending_buffer[32];
+    usb_report_pending_t pending;
+};
+
+static Report keyboard_report(uint8_t mods, uint8_t key) {
+    return Report{mods, 0, key, 0, 0, 0, 0, 0};
+}
+
+enum { REPORT_ID_CONSUMER = 3, REPORT_ID_NKRO = 6 };
+
+static Report consumer_report(uint16_t usage) {
+    return Report{REPORT_ID_CONSUMER, (uint8_t)(usage & 0xFF), (uint8_t)(usage >> 8)};
+}
+
+static Report nkro_report(uint8_t bits) {
+    return Report{REPORT_ID_NKRO, 0, bits};
+}
+
+TEST(UsbReportQueue, SendString_EveryPressAndReleaseInOrder) {
+    Endpoint            endpoint(false);
+    std::vector<Report> sent;
+
+    // A SEND_STRING burst, several times faster than the host polls
+    for (uint8_t key = 4; key < 4 + 26; ++key) {
+        sent.push_back(keyboard_report(key % 3 ? 0 : 0x02, key));
+        sent.push_back(keyboard_report(0, 0));
+        endpoint.send(sent[sent.size() - 2], false);
+        endpoint.send(sent[sent.size() - 1], false);
+        if (key % 3 == 0) {
+            endpoint.host_takes_one();
+        }
+    }
+    endpoint.host_takes_all();
+
+    EXPECT_EQ(endpoint.received, sent);
+    EXPECT_EQ(endpoint.merged, 0);
+    EXPECT_GT(endpoint.waited, 0);
+}
+
+TEST(UsbReportQueue, Nkro_NotReplacedAndNotOvertaken) {
+    Endpoint endpoint(true);
+
+    for (uint8_t bits = 1; bits <= Endpoint::CAPACITY; ++bits) {
+        endpoint.send(nkro_report(bits), false);
+    }
+    endpoint.send(consumer_report(0xE9), false);
+    endpoint.send(nkro_report(0x10), false);
+    endpoint.send(nkro_report(0x00), false);
+    endpoint.host_takes_all();
+
+    std::vector<Report> expected = {nkro_report(1), nkro_report(2), nkro_report(3), nkro_report(4), consumer_report(0xE9), nkro_report(0x10), nkro_report(0x00)};
+    EXPECT_EQ(endpoint.received, expected);
+    EXPECT_EQ(endpoint.merged, 0);
+}
+
+TEST(UsbReportQueue, Consumer_TapWhileFull_PressIsStillDelivered) {
+    Endpoint endpoint(true);
+
+    for (uint8_t bits = 1; bits <= Endpoint::CAPACITY; ++bits) {
+        endpoint.send(nkro_report(bits), false);
+    }
+    // tap_code(KC_VOLU)
+    endpoint.send(consumer_report(0xE9), false);
+    endpoint.send(consumer_report(0), false);
+    endpoint.host_takes_all();
+
+    ASSERT_EQ(endpoint.received.size(), Endpoint::CAPACITY + 2);
+    EXPECT_EQ(endpoint.received[Endpoint::CAPACITY], consumer_report(0xE9));
+    EXPECT_EQ(endpoint.received[Endpoint::CAPACITY + 1], consumer_report(0));
+    EXPECT_EQ(endpoint.merged, 0);
+}
+
+TEST(UsbReportQueue, Keyboard_WaitsWhenFull) {
+    uint8_t              buffer[8] = {0};
+    usb_report_pending_t pending   = {buffer, 0};
+    Report               report    = keyboard_report(0, 4);
+
+    EXPECT_EQ(usb_report_queue_action(&pending, false, report.data(), report.size(), false, false), USB_REPORT_QUEUE_POST);
+    EXPECT_EQ(usb_report_queue_action(&pending, true, report.data(), report.size(), false, false), USB_REPORT_QUEUE_WAIT);
+}
+
+TEST(UsbReportQueue, KeptAside_NothingOvertakesIt) {
+    uint8_t              buffer[8] = {REPORT_ID_CONSUMER, 0xE9, 0};
+    usb_report_pending_t pending   = {buffer, 3};
+    Report               consumer  = consumer_report(0xEA);
+    Report               nkro      = nkro_report(1);
+
+    EXPECT_EQ(usb_report_queue_action(&pending, false, consumer.data(), consumer.size(), true, true), USB_REPORT_QUEUE_REPLACE);
+    EXPECT_EQ(usb_report_queue_action(&pending, false, nkro.data(), nkro.size(), true, false), USB_REPORT_QUEUE_WAIT);
+}
@@ -0,0 +1,20 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "usb_report_queue.h"
+
+usb_report_queue_action_t usb_report_queue_action(const usb_report_pending_t *pending, bool queue_full, const uint8_t *data, size_t size, bool has_report_id, bool mergeable) {
+    // The report kept aside goes out first, so nothing may overtake it
+    if (pending->size == 0 && !queue_full) {
+        return USB_REPORT_QUEUE_POST;
+    }
+    if (!mergeable) {
+        return USB_REPORT_QUEUE_WAIT;
+    }
+    if (pending->size == 0) {
+        return USB_REPORT_QUEUE_KEEP;
+    }
+
+    bool same_kind = pending->size == size && (!has_report_id || pending->buffer[0] == data[0]);
+    return same_kind ? USB_REPORT_QUEUE_REPLACE : USB_REPORT_QUEUE_WAIT;
+}
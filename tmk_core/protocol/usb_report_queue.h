@@ -0,0 +1,44 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A report that found the endpoint's queue full, kept aside until a buffer frees up.
+ */
+typedef struct {
+    uint8_t *buffer;
+    size_t   size;
+} usb_report_pending_t;
+
+typedef enum {
+    /** A buffer is free, post the report to it */
+    USB_REPORT_QUEUE_POST,
+    /** Keep the report aside, nothing was waiting */
+    USB_REPORT_QUEUE_KEEP,
+    /** Keep the report aside in place of the waiting report of the same kind */
+    USB_REPORT_QUEUE_REPLACE,
+    /** Wait for a free buffer, as a blocking send does */
+    USB_REPORT_QUEUE_WAIT,
+} usb_report_queue_action_t;
+
+/**
+ * Decides what to do with a report to be sent without waiting for the endpoint.
+ *
+ * Only reports that carry the absolute state of their inputs, and nothing that happened in between,
+ * may replace one another. Keyboard, NKRO, consumer, system, joystick and digitizer reports are never
+ * replaced, as each one records a press or a release and a tap would be lost, so they wait for the
+ * queue instead.
+ *
+ * @param pending[in] the report kept aside, if any
+ * @param queue_full[in] whether every buffer of the endpoint's queue is in use
+ * @param data[in] the report
+ * @param size[in] size of the report
+ * @param has_report_id[in] the first byte of the report is its report ID
+ * @param mergeable[in] a newer report of the same kind carries everything this one does
+ */
+usb_report_queue_action_t usb_report_queue_action(const usb_report_pending_t *pending, bool queue_full, const uint8_t *data, size_t size, bool has_report_id, bool mergeable);